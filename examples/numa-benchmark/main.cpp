@@ -0,0 +1,107 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  Compares population placements on NUMA machines: a plain std::vector touched by the main thread, a
+ *  first-touched LocalArray swept by pinned threads, and the same backed by huge pages.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Util/LocalArray.hpp"
+#include "Util/Parallel.hpp"
+#include "Util/Topology.hpp"
+
+
+using namespace moxie::Util;
+
+
+static constexpr std::size_t dimensions = 16;
+static constexpr std::size_t passes = 10;
+
+// One generation's worth of memory traffic: evaluate every genome (sphere function), then perturb it
+void sweep(double* genes, double* fitness, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+        double* row = genes + i * dimensions;
+
+        double sum = 0.0;
+        for (std::size_t d = 0; d < dimensions; ++d) sum += row[d] * row[d];
+        fitness[i] = sum;
+
+        for (std::size_t d = 0; d < dimensions; ++d) row[d] = row[d] * 0.5 + 1.0;
+    }
+}
+
+template <typename Setup>
+void run(const std::string& name, Setup setup) {
+    const auto start = std::chrono::steady_clock::now();
+    const auto elapsed = setup();
+    const auto total = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << name << "\tsweeps: " << elapsed << "s\ttotal (incl. allocation): " << total << "s" << std::endl;
+}
+
+template <typename Fn>
+double seconds(Fn fn) {
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+int main(const int argc, const char** argv) {
+    // --
+    // The population should be much larger than the last-level cache to measure memory placement
+    const std::size_t population_size = (argc > 1) ? std::stoul(argv[1]) : (std::size_t{1} << 22);
+
+    const auto topology = Topology::detect();
+    // The topology only holds the CPUs this process may run on, so this never oversubscribes a cpuset
+    const auto threads  = topology.cpus().size();
+    const auto cpus     = topology.schedule(threads);
+
+    std::cout << "cpus: " << threads << "\tnodes: " << topology.nodes()
+              << "\tpopulation: " << population_size << " x " << dimensions << std::endl;
+
+    // --
+    // Baseline: the main thread touches everything, so all pages land on its node
+    run("vector", [&] {
+        std::vector<double> genes(population_size * dimensions, 1.0);
+        std::vector<double> fitness(population_size);
+
+        return seconds([&] {
+            for (std::size_t pass = 0; pass < passes; ++pass) {
+                parallel_for(population_size, threads, [&](std::size_t, std::size_t begin, std::size_t end) {
+                    sweep(genes.data(), fitness.data(), begin, end);
+                });
+            }
+        });
+    });
+
+    // --
+    // Each pinned thread first touches (and then only ever sweeps) its own slice
+    const auto local = [&](Pages pages) {
+        return [&, pages] {
+            LocalArray<double> genes{population_size, dimensions, threads, cpus, pages};
+            LocalArray<double> fitness{population_size, 1, threads, cpus, pages};
+            parallel_for(population_size, threads, cpus, [&](std::size_t, std::size_t begin, std::size_t end) {
+                std::fill(genes.row(begin), genes.row(end), 1.0);
+            });
+
+            return seconds([&] {
+                for (std::size_t pass = 0; pass < passes; ++pass) {
+                    parallel_for(population_size, threads, cpus, [&](std::size_t, std::size_t begin, std::size_t end) {
+                        sweep(genes.data(), fitness.data(), begin, end);
+                    });
+                }
+            });
+        };
+    };
+
+    run("local", local(Pages::Normal));
+    run("local+huge", local(Pages::Huge));
+
+    return EXIT_SUCCESS;
+}
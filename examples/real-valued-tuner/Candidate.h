@@ -1,36 +1,38 @@
 #pragma once
 
-#include <vector>
+#include <array>
 #include <random>
 
 #include "Genetics/Genome.hpp"
 
 using namespace moxie::Genetics;
 
+template <std::size_t Dimensions>
 struct Candidate {
     //! This is the underlying Genome type (more complicated implementations can have multiple different types)
     using GeneType = Genome<double>;
 
+    //! The number of genes is known at compile-time, so they are stored inline (no heap allocation)
+    using SequenceType = FixedSequence<double, Dimensions>;
+
     //! Each candidate solution contains a sequence of genes
-    std::vector<GeneType> genes;
+    SequenceType genes;
 
     //! This constructor creates a random candidate solution
     using Domain = std::uniform_real_distribution<double>;
-    Candidate(std::size_t dimensions, Domain& domain, std::mt19937& rng) {
-        genes.reserve(dimensions);
-        for (std::size_t i = 0; i < dimensions; ++i) {
-            genes.emplace_back(domain(rng));
-        }
-    }
+    Candidate(Domain& domain, std::mt19937& rng)
+        : genes(make_fixed_sequence<double, Dimensions>([&](auto) { return domain(rng); })) {}
 
-    Candidate(std::vector<GeneType>&& values) : genes(std::move(values)) {}
+    Candidate(SequenceType&& values) : genes(std::move(values)) {}
 
-    void mutate(const std::function<double(double)>& mutator) {
-        for (auto& gene : genes) gene.mutate(mutator);
+    void mutate(const GeneType::MutationFunction& mutator) {
+        mutate_all(genes, mutator);
     }
 
     // These are the defaulted constructors
-    Candidate() = default;
     Candidate(const Candidate& other) = default;
+    Candidate(Candidate&& other) = default;
+    Candidate& operator=(const Candidate& other) = default;
+    Candidate& operator=(Candidate&& other) = default;
     ~Candidate() = default;
 };
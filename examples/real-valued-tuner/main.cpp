@@ -8,9 +8,13 @@
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include <numeric>
 #include <random>
 
 #include "Genetics/Crossover.hpp"
+#include "Genetics/Diversity.hpp"
+#include "Genetics/Reproduction.hpp"
+#include "Genetics/Scaling.hpp"
 #include "Genetics/Selection.hpp"
 
 // This includes specific boilerplate code
@@ -22,10 +26,15 @@ using namespace moxie::Genetics;
 
 static constexpr std::size_t dimensions = 2;
 static constexpr std::size_t population_size = 100;
+static constexpr double base_mutation_rate = 0.2;
+static constexpr double target_diversity = 1.0;
+
+// The dimensionality is fixed at compile-time, so each candidate stores its genes inline
+using Individual = Candidate<dimensions>;
 
 // This is a fitness function based on Xin-She Yang N.4
 // https://towardsdatascience.com/optimization-eye-pleasure-78-benchmark-test-functions-for-single-objective-optimization-92e7ed1d1f12
-double f(const Candidate& candidate) {
+double f(const Individual& candidate) {
     double left_a = 0;
     double left_b = 0;
     double right_a = 0;
@@ -39,17 +48,13 @@ double f(const Candidate& candidate) {
 }
 
 // We can view the population as a vector of candidates
-using Population = std::vector<Candidate>;
+using Population = std::vector<Individual>;
 
 
 int main(const int argc, const char** argv) {
     // --
     // The known optimum for this problem is at [0,...,0]
-    const auto known_optimum = []() {
-        Candidate candidate;
-        candidate.genes = std::vector<Candidate::GeneType>(dimensions, Genome{0.0});
-        return candidate;
-    }();
+    const auto known_optimum = Individual{make_fixed_sequence<double, dimensions>([](auto) { return 0.0; })};
 
     Population foo;
 
@@ -59,25 +64,29 @@ int main(const int argc, const char** argv) {
 
     std::uniform_real_distribution<double> domain{-10.0, 10.0};
     std::uniform_real_distribution<double> variance{-0.1, 0.1};
-    std::bernoulli_distribution willMutate{0.2};
+    std::bernoulli_distribution willMutate{base_mutation_rate};
+
+    // The mutation rate is adapted each generation to keep the population from collapsing onto clones
+    const auto genes_of = [](const Individual& candidate) -> const auto& { return candidate.genes; };
 
     // --
-    // This is the mutation we are going to apply to each gene in the sequence
-    auto random_mutation = [&](double value) {
-        return !willMutate(rng) ? value : std::clamp(value + variance(rng), domain.min(), domain.max());
+    // This is the mutation we are going to apply to each gene in the sequence (drawing from the given stream,
+    // so that children can be bred in parallel)
+    auto random_mutation = [&](std::mt19937& stream, double value) {
+        auto will_mutate = willMutate;
+        auto delta = variance;
+        return !will_mutate(stream) ? value : std::clamp(value + delta(stream), domain.min(), domain.max());
     };
 
     // --
     // Create the initial population, populating it with random candidates
     Population pop_current;      pop_current.reserve(population_size);
-    Population pop_next;            pop_next.reserve(population_size);
 
-    for (std::size_t i = 0; i < population_size; ++i) { pop_current.emplace_back(dimensions, domain, rng); }
+    for (std::size_t i = 0; i < population_size; ++i) { pop_current.emplace_back(domain, rng); }
 
     // This will store the fitness of each member of the population
     std::vector<double> pop_fitness(population_size, 0.0);
-
-    Crossover::Splicer splicer{};
+    std::vector<double> selection_fitness(population_size, 0.0);
 
     // --
     // We are going to simulate evolution of the population over 100 generations
@@ -86,42 +95,58 @@ int main(const int argc, const char** argv) {
         for (std::size_t i = 0; i < pop_current.size(); ++i) { pop_fitness[i] = f(pop_current[i]); }
 
         const auto avg_fitness = std::reduce(pop_fitness.begin(), pop_fitness.end()) / population_size;
+        const auto [min_fitness, max_fitness] = std::minmax_element(pop_fitness.begin(), pop_fitness.end());
         std::cout << "generation: "    << generation_i
                   << "\tavg fitness: " << avg_fitness
-                  << "\tmin: " << *std::min(pop_fitness.begin(), pop_fitness.end())
-                  << "\tmax: " << *std::max(pop_fitness.begin(), pop_fitness.end()) << std::endl;
+                  << "\tmin: " << *min_fitness
+                  << "\tmax: " << *max_fitness << std::endl;
 
 
 
+        // --
+        // Mutate more aggressively when the population has lost its diversity
+        const auto diversity = Diversity::mean_pairwise_distance(Diversity::gene_variance(pop_current, genes_of), pop_current.size());
+        willMutate = std::bernoulli_distribution{
+            Diversity::adaptive_mutation_rate(diversity, target_diversity, base_mutation_rate, 0.05, 0.8)
+        };
+
         // --
         // We need to select N/2 individuals from the population
         const auto num_survivors = population_size / 2;
 
-        pop_next.clear();
-        const auto selected_i = Selection::proportional_selection(pop_fitness,
+        // f is an objective value (lower is better, and possibly negative), so it is converted to a
+        // relative fitness before selecting proportionally to it
+        selection_fitness = pop_fitness;
+        Scaling::objective(selection_fitness);
+
+        const auto selected_i = Selection::proportional_selection(selection_fitness,
                                                                   num_survivors,
                                                                   rng);
 
-        std::for_each(selected_i.begin(), selected_i.end(), [&](auto i) { pop_next.push_back(pop_current[i]); });
-        std::shuffle(pop_next.begin(), pop_next.end(), rng);
+        // Move the survivors to the front of the population (in-place, without copying)
+        Selection::compact(pop_current, selected_i);
+        std::shuffle(pop_current.begin(), pop_current.begin() + num_survivors, rng);
 
         static constexpr double p_entanglement = 0.37;
 
-        // Now we need to generate pairwise members of the population
-        for (std::size_t i = 0, j = 1; j < num_survivors; i+=2, j+=2) {
-            const auto& parent_a = pop_next[i];
-            const auto& parent_b = pop_next[j];
-
-            auto [sequence_a, sequence_b] = splicer.uniform_crossover(parent_a.genes, parent_b.genes, p_entanglement);
-
-            for (auto& gene : sequence_a) gene.mutate(random_mutation);
-            for (auto& gene : sequence_b) gene.mutate(random_mutation);
-
-            pop_next.emplace_back(std::move(sequence_a));
-            pop_next.emplace_back(std::move(sequence_b));
-        }
-
-        pop_current.clear();
-        pop_current = pop_next;
+        // Now we need to generate pairwise members of the population, writing the children over the
+        // members that didn't survive (pairs are bred in parallel for large populations)
+        std::vector<std::size_t> parents(num_survivors);
+        std::iota(parents.begin(), parents.end(), 0);
+
+        // The two draws are sequenced explicitly, so the seed doesn't depend on the compiler's evaluation order
+        const std::uint64_t seed_hi = rng();
+        const std::uint64_t seed_lo = rng();
+        const auto seed = (seed_hi << 32) | seed_lo;
+        Reproduction::breed(pop_current, parents, pop_current, num_survivors, seed,
+            [&](Crossover::Splicer& splicer, std::mt19937& stream, const Individual& parent_a, const Individual& parent_b) {
+                auto [sequence_a, sequence_b] = splicer.uniform_crossover(parent_a.genes, parent_b.genes, p_entanglement);
+
+                const auto mutation = [&](double value) { return random_mutation(stream, value); };
+                mutate_all(sequence_a, mutation);
+                mutate_all(sequence_b, mutation);
+
+                return std::make_pair(Individual{std::move(sequence_a)}, Individual{std::move(sequence_b)});
+            });
     }
 }
@@ -0,0 +1,98 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  A bitmap of the genes that changed between a parent and a child.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+
+namespace moxie::Genetics {
+
+/**
+ *  @short  Tracks which genes of a sequence have changed relative to a (scored) parent, so the fitness
+ *          of the child can be updated incrementally rather than recomputed from scratch.
+ */
+class ChangeSet {
+public:
+    ChangeSet() = default;
+    explicit ChangeSet(std::size_t size) : m_words((size + 63) / 64, 0), m_size(size) {}
+
+    //! @short  The number of genes tracked by the set.
+    [[nodiscard]] std::size_t size() const { return m_size; }
+
+    //! @short  Clears the set, and resizes it to track the given number of genes.
+    void reset(std::size_t size) { m_words.assign((size + 63) / 64, 0); m_size = size; }
+
+    //! @short  Clears the set (no genes have changed).
+    void clear() { std::fill(m_words.begin(), m_words.end(), 0); }
+
+    //! @short  Marks the i'th gene as changed.
+    void mark(std::size_t i) { check(i); m_words[i / 64] |= std::uint64_t{1} << (i % 64); }
+
+    //! @short  Returns true if the i'th gene has changed.
+    [[nodiscard]] bool test(std::size_t i) const { check(i); return (m_words[i / 64] >> (i % 64)) & 1; }
+
+    //! @short  Returns the number of changed genes.
+    [[nodiscard]] std::size_t count() const;
+
+    //! @short  Returns the indices of the changed genes, in ascending order.
+    [[nodiscard]] std::vector<std::size_t> indices() const;
+
+    //! @short  Marks every gene that has changed in the other set as changed in this set.
+    ChangeSet& operator|=(const ChangeSet& other);
+
+private:
+    void check(std::size_t i) const {
+        if (i >= m_size) throw std::out_of_range("gene index is out of range of the change set");
+    }
+
+    std::vector<std::uint64_t> m_words;
+    std::size_t                m_size = 0;
+};
+
+
+//! @short  Marks every gene at which the child differs from the parent.
+template <typename Container>
+void mark_differences(const Container& parent, const Container& child, ChangeSet& changes);
+
+//! @short  Applies the mutation function to every gene in the sequence, marking the genes whose value changed.
+template <typename Container>
+void mutate_all(Container& sequence,
+                const typename Container::value_type::MutationFunction& fn,
+                ChangeSet& changes);
+
+
+// --
+// Implementations
+template <typename Container>
+void mark_differences(const Container& parent, const Container& child, ChangeSet& changes) {
+    if (parent.size() != child.size() || changes.size() != child.size()) {
+        throw std::range_error("cannot compare sequences of different sizes");
+    }
+
+    for (std::size_t i = 0; i < child.size(); ++i) {
+        if (parent[i] != child[i]) changes.mark(i);
+    }
+}
+
+template <typename Container>
+void mutate_all(Container& sequence,
+                const typename Container::value_type::MutationFunction& fn,
+                ChangeSet& changes) {
+    if (changes.size() != sequence.size()) {
+        throw std::range_error("change set does not match the size of the sequence");
+    }
+
+    for (std::size_t i = 0; i < sequence.size(); ++i) {
+        const auto before = sequence[i].value();
+        sequence[i].mutate(fn);
+        if (sequence[i].value() != before) changes.mark(i);
+    }
+}
+
+} // namespace moxie::Genetics
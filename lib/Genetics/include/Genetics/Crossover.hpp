@@ -6,21 +6,38 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <random>
+#include <stdexcept>
+#include <utility>
+
+#include "Genetics/ChangeSet.hpp"
 
 
 namespace moxie::Genetics::Crossover {
 
 /**
  *  @short  This class provides an interface to splice sequences of DNA.
+ *
+ *  @note   Sequences may be resizable (e.g. std::vector) or fixed-size (e.g. std::array); children are
+ *          created as copies of their parents and spliced in place, so no default construction or
+ *          push_back is required of the container.
  */
 class Splicer {
 private:
     std::mt19937 m_rng;
 public:
+    //! @short  Creates a splicer seeded from std::random_device.
     Splicer();
+
+    //! @short  Creates a splicer with a deterministic seed (e.g. one independent stream per thread).
+    explicit Splicer(std::seed_seq& seed);
     ~Splicer() = default;
 
+    //! @short  Reseed the splicer's random number generator.
+    void seed(std::seed_seq& seed) { m_rng.seed(seed); }
+
 
     /**
      *  @short  Generates child DNA by performing a binary crossover at a random splice point between
@@ -37,12 +54,36 @@ public:
     [[nodiscard]] static std::pair<T,T> binary_crossover(const T& parent_a,
                                                          const T& parent_b, std::size_t splice_point);
 
+    /**
+     *  @short  Generates child DNA by performing a binary crossover at a splice point known at compile-time
+     *          between fixed-size parent DNA sequences.
+     */
+    template <std::size_t SplicePoint, typename T, std::size_t N>
+    [[nodiscard]] static std::pair<std::array<T, N>, std::array<T, N>> binary_crossover(const std::array<T, N>& parent_a,
+                                                                                        const std::array<T, N>& parent_b);
+
     /**
      *  @short  Generates child DNA by performing a uniform crossover with a given probability p.
      */
     template <typename T>
     [[nodiscard]] std::pair<T,T> uniform_crossover(const T& parent_a, const T& parent_b, double p);
 
+    /**
+     *  @short  Generates child DNA by performing a binary crossover at a random splice point, marking the genes
+     *          of each child that differ from its own parent (child_a from parent_a, child_b from parent_b).
+     */
+    template <typename T>
+    [[nodiscard]] std::pair<T,T> binary_crossover(const T& parent_a, const T& parent_b,
+                                                  ChangeSet& changes_a, ChangeSet& changes_b);
+
+    /**
+     *  @short  Generates child DNA by performing a uniform crossover with a given probability p, marking the genes
+     *          of each child that differ from its own parent (child_a from parent_a, child_b from parent_b).
+     */
+    template <typename T>
+    [[nodiscard]] std::pair<T,T> uniform_crossover(const T& parent_a, const T& parent_b, double p,
+                                                   ChangeSet& changes_a, ChangeSet& changes_b);
+
 };
 
 
@@ -68,15 +109,20 @@ std::pair<Container, Container> Splicer::binary_crossover(const Container& paren
         throw std::range_error("splice point not within bounds of parent");
     }
 
-    Container child_a, child_b;
-    child_a.reserve(parent_a.size());
-    child_b.reserve(parent_a.size());
+    // child_a takes the head of parent_b and the tail of parent_a (and vice versa for child_b)
+    Container child_a(parent_a), child_b(parent_b);
+    std::swap_ranges(child_a.begin(), child_a.begin() + splice_point, child_b.begin());
+
+    return std::make_pair(std::move(child_a), std::move(child_b));
+}
 
-    std::copy(parent_a.begin(), parent_a.begin() + splice_point, std::back_inserter(child_b));
-    std::copy(parent_b.begin(), parent_b.begin() + splice_point, std::back_inserter(child_a));
+template <std::size_t SplicePoint, typename T, std::size_t N>
+std::pair<std::array<T, N>, std::array<T, N>> Splicer::binary_crossover(const std::array<T, N>& parent_a,
+                                                                        const std::array<T, N>& parent_b) {
+    static_assert(SplicePoint <= N, "splice point not within bounds of parent");
 
-    std::copy(parent_a.begin() + splice_point, parent_a.end(),   std::back_inserter(child_a));
-    std::copy(parent_b.begin() + splice_point, parent_b.end(),   std::back_inserter(child_b));
+    std::array<T, N> child_a(parent_a), child_b(parent_b);
+    std::swap_ranges(child_a.begin(), child_a.begin() + SplicePoint, child_b.begin());
 
     return std::make_pair(std::move(child_a), std::move(child_b));
 }
@@ -94,19 +140,59 @@ std::pair<T,T> Splicer::uniform_crossover(const T &parent_a, const T &parent_b,
 
     std::bernoulli_distribution distrib{p};
 
-    T child_a, child_b;
-    child_a.reserve(parent_a.size());
-    child_b.reserve(parent_a.size());
+    // Children start as images of their parents, and each element is swapped with probability p
+    T child_a(parent_a), child_b(parent_b);
 
     for (std::size_t i = 0; i < parent_a.size(); ++i) {
         if (distrib(m_rng)) {
             // Swap this element
-            child_a.push_back(parent_b[i]);
-            child_b.push_back(parent_a[i]);
-        } else {
-            // Keep same element
-            child_a.push_back(parent_a[i]);
-            child_b.push_back(parent_b[i]);
+            std::swap(child_a[i], child_b[i]);
+        }
+    }
+
+    return std::make_pair(std::move(child_a), std::move(child_b));
+}
+
+
+template <typename T>
+std::pair<T,T> Splicer::binary_crossover(const T& parent_a, const T& parent_b,
+                                         ChangeSet& changes_a, ChangeSet& changes_b) {
+    if (changes_a.size() != parent_a.size() || changes_b.size() != parent_b.size()) {
+        throw std::range_error("change sets do not match the size of the parents");
+    }
+
+    auto children = binary_crossover(parent_a, parent_b);
+
+    // Only the head of each child was taken from the other parent, but the splice point isn't returned
+    mark_differences(parent_a, children.first, changes_a);
+    mark_differences(parent_b, children.second, changes_b);
+
+    return children;
+}
+
+template <typename T>
+std::pair<T,T> Splicer::uniform_crossover(const T& parent_a, const T& parent_b, const double p,
+                                          ChangeSet& changes_a, ChangeSet& changes_b) {
+    if (parent_a.size() != parent_b.size()) {
+        throw std::range_error("cannot crossover sequences of different sizes");
+    } else if (changes_a.size() != parent_a.size() || changes_b.size() != parent_b.size()) {
+        throw std::range_error("change sets do not match the size of the parents");
+    } else if (p < 0) {
+        throw std::invalid_argument("crossover probability cannot be less than 0");
+    } else if (p > 1) {
+        throw std::invalid_argument("crossover probability cannot be greater than 1");
+    }
+
+    std::bernoulli_distribution distrib{p};
+
+    T child_a(parent_a), child_b(parent_b);
+
+    for (std::size_t i = 0; i < parent_a.size(); ++i) {
+        // Swapping equal genes doesn't change either child
+        if (distrib(m_rng) && child_a[i] != child_b[i]) {
+            std::swap(child_a[i], child_b[i]);
+            changes_a.mark(i);
+            changes_b.mark(i);
         }
     }
 
@@ -0,0 +1,181 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  Population diversity metrics and duplicate elimination.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+
+namespace moxie::Genetics::Diversity {
+
+//! @short  The default projection, which treats each member of the population as its own sequence of genes.
+struct Identity {
+    template <typename U>
+    const U& operator()(const U& value) const { return value; }
+};
+
+//! @short  Combine a hash value into a running seed.
+inline std::size_t hash_combine(std::size_t seed, std::size_t value) {
+    return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+//! @short  Returns a hash of the values of a sequence of genes (works for Sequence and FixedSequence).
+template <typename Container>
+[[nodiscard]] std::size_t hash_sequence(const Container& sequence);
+
+/**
+ *  @short  Returns the indices of the distinct members of the population (the first occurrence of each genome),
+ *          using a hash set rebuilt on every call. The projection maps a member to its sequence of genes.
+ */
+template <typename T, typename Projection = Identity>
+[[nodiscard]] std::vector<std::size_t>
+        distinct(const std::vector<T>& population,
+                 Projection projection = {});
+
+/**
+ *  @short  Returns the indices of the approximately distinct members of a real-valued population, keeping the
+ *          first member that falls into each grid cell of width cell_size (in every dimension).
+ */
+template <typename T, typename Projection = Identity>
+[[nodiscard]] std::vector<std::size_t>
+        distinct_approx(const std::vector<T>& population,
+                        double cell_size,
+                        Projection projection = {});
+
+
+/**
+ *  @short  Returns the variance of each gene across the population, where genes is a row-major matrix
+ *          of population_size rows and dimensions columns.
+ */
+[[nodiscard]] std::vector<double> gene_variance(const std::vector<double>& genes, std::size_t dimensions);
+
+/**
+ *  @short  Returns the variance of each gene across a real-valued population.
+ */
+template <typename T, typename Projection = Identity>
+[[nodiscard]] std::vector<double>
+        gene_variance(const std::vector<T>& population,
+                      Projection projection = {});
+
+/**
+ *  @short  Returns the root-mean-square euclidean distance between all distinct pairs (i < j) of the
+ *          population_size members whose per-gene variances are given.
+ *
+ *  @note   The squared distances summed over all pairs are n^2 times twice the sum of the per-gene variances,
+ *          and the self-pairs contribute nothing, so this is computed in O(d) time rather than by visiting
+ *          all O(n^2) pairs.
+ */
+[[nodiscard]] double mean_pairwise_distance(const std::vector<double>& variance, std::size_t population_size);
+
+/**
+ *  @short  Scales the base mutation rate by how far the diversity has fallen below (or risen above) the target
+ *          diversity, clamped to [min_rate, max_rate].
+ */
+[[nodiscard]] double adaptive_mutation_rate(double diversity,
+                                            double target_diversity,
+                                            double base_rate,
+                                            double min_rate = 0.0,
+                                            double max_rate = 1.0);
+
+
+
+// --
+// Function definitions to follow
+
+template <typename Container>
+std::size_t hash_sequence(const Container& sequence) {
+    std::size_t seed = sequence.size();
+    for (const auto& gene : sequence) {
+        seed = hash_combine(seed, std::hash<std::decay_t<decltype(gene.value())>>{}(gene.value()));
+    }
+
+    return seed;
+}
+
+template <typename T, typename Projection>
+std::vector<std::size_t> distinct(const std::vector<T>& population,
+                                  Projection projection) {
+    // The set stores indices into the population, hashing and comparing the genomes they refer to
+    auto hash  = [&](std::size_t i) { return hash_sequence(projection(population[i])); };
+    auto equal = [&](std::size_t i, std::size_t j) {
+        const auto& a = projection(population[i]);
+        const auto& b = projection(population[j]);
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+    };
+
+    std::unordered_set<std::size_t, decltype(hash), decltype(equal)> seen(population.size(), hash, equal);
+
+    std::vector<std::size_t> out{}; out.reserve(population.size());
+    for (std::size_t i = 0; i < population.size(); ++i) {
+        if (seen.insert(i).second) out.push_back(i);
+    }
+
+    return out;
+}
+
+template <typename T, typename Projection>
+std::vector<std::size_t> distinct_approx(const std::vector<T>& population,
+                                         double cell_size,
+                                         Projection projection) {
+    // --
+    // Error check our inputs
+    if (!(cell_size > 0)) { throw std::invalid_argument("cell size must be greater than 0"); }
+
+    // Each member is reduced to the coordinates of the grid cell it falls in
+    std::vector<std::vector<std::int64_t>> cells{}; cells.reserve(population.size());
+    for (const auto& member : population) {
+        const auto& sequence = projection(member);
+
+        auto& cell = cells.emplace_back(); cell.reserve(sequence.size());
+        for (const auto& gene : sequence) {
+            cell.push_back(static_cast<std::int64_t>(std::floor(gene.value() / cell_size)));
+        }
+    }
+
+    auto hash = [&](std::size_t i) {
+        std::size_t seed = cells[i].size();
+        for (const auto coordinate : cells[i]) seed = hash_combine(seed, std::hash<std::int64_t>{}(coordinate));
+        return seed;
+    };
+    auto equal = [&](std::size_t i, std::size_t j) { return cells[i] == cells[j]; };
+
+    std::unordered_set<std::size_t, decltype(hash), decltype(equal)> seen(population.size(), hash, equal);
+
+    std::vector<std::size_t> out{}; out.reserve(population.size());
+    for (std::size_t i = 0; i < population.size(); ++i) {
+        if (seen.insert(i).second) out.push_back(i);
+    }
+
+    return out;
+}
+
+template <typename T, typename Projection>
+std::vector<double> gene_variance(const std::vector<T>& population,
+                                  Projection projection) {
+    if (population.empty()) return {};
+
+    // Flatten the gene values into a contiguous row-major matrix so the reductions can be vectorized
+    const auto dimensions = projection(population.front()).size();
+
+    std::vector<double> genes{}; genes.reserve(population.size() * dimensions);
+    for (const auto& member : population) {
+        const auto& sequence = projection(member);
+        if (sequence.size() != dimensions) {
+            throw std::invalid_argument("all members of the population must have the same number of genes");
+        }
+
+        for (const auto& gene : sequence) genes.push_back(static_cast<double>(gene.value()));
+    }
+
+    return gene_variance(genes, dimensions);
+}
+
+} // namespace moxie::Genetics::Diversity
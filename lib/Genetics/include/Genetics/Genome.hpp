@@ -6,7 +6,10 @@
  */
 #pragma once
 
+#include <array>
 #include <functional>
+#include <utility>
+#include <vector>
 
 
 namespace moxie::Genetics {
@@ -34,4 +37,50 @@ private:
     T m_Value;
 };
 
+
+//! A sequence of genes whose length is only known at runtime (heap allocated)
+template <typename T>
+using Sequence = std::vector<Genome<T>>;
+
+//! A sequence of genes whose length N is known at compile-time (stored inline, no heap allocation)
+template <typename T, std::size_t N>
+using FixedSequence = std::array<Genome<T>, N>;
+
+
+/**
+ *  @short  Creates a FixedSequence of N genes, where the i'th gene is initialized with fn(i).
+ *
+ *  @note   Genome has no default constructor, so this is the way to build a std::array of genes.
+ *          The genes are initialized in order, so fn may safely draw from a random number generator.
+ */
+template <typename T, std::size_t N, typename Fn>
+[[nodiscard]] FixedSequence<T, N> make_fixed_sequence(Fn&& fn);
+
+//! @short  Applies the mutation function to every gene in the sequence (works for Sequence and FixedSequence).
+template <typename Container>
+void mutate_all(Container& sequence, const typename Container::value_type::MutationFunction& fn);
+
+
+// --
+// Implementations
+namespace detail {
+
+template <typename T, typename Fn, std::size_t... I>
+FixedSequence<T, sizeof...(I)> make_fixed_sequence(Fn& fn, std::index_sequence<I...>) {
+    // Braced initialization guarantees fn is called in index order
+    return {{ Genome<T>{fn(I)}... }};
+}
+
+} // namespace detail
+
+template <typename T, std::size_t N, typename Fn>
+FixedSequence<T, N> make_fixed_sequence(Fn&& fn) {
+    return detail::make_fixed_sequence<T>(fn, std::make_index_sequence<N>{});
+}
+
+template <typename Container>
+void mutate_all(Container& sequence, const typename Container::value_type::MutationFunction& fn) {
+    for (auto& gene : sequence) gene.mutate(fn);
+}
+
 } // namespace moxie::Genetics
@@ -0,0 +1,154 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  Incremental (delta) fitness evaluation for sparsely mutated children.
+ */
+#pragma once
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Genetics/ChangeSet.hpp"
+
+
+namespace moxie::Genetics::Incremental {
+
+/**
+ *  @short  Evaluates a child, either from scratch or incrementally from its parent's cached state.
+ *
+ *          An incremental fitness function provides two overloads, both returning its State type:
+ *              - evaluate(genes)                          a full O(n) evaluation
+ *              - evaluate(parent_state, genes, changes)   an update from the state of the parent the child
+ *                                                         was derived from, given the genes that changed
+ *
+ *          The full evaluation is used when there is no scored parent, or when more than max_fraction of
+ *          the genes changed (at which point an incremental update no longer pays for itself).
+ */
+template <typename Fitness, typename State, typename Container>
+[[nodiscard]] State evaluate(const Fitness& fitness,
+                             const State* parent_state,
+                             const Container& genes,
+                             const ChangeSet& changes,
+                             double max_fraction = 0.5);
+
+/**
+ *  @short  As evaluate(), but updates a state the caller owns in place (e.g. a child's copy of its parent's
+ *          state), so an incremental update doesn't pay for copying the whole state.
+ *
+ *          The fitness function must additionally provide update(state, genes, changes).
+ */
+template <typename Fitness, typename State, typename Container>
+void update(const Fitness& fitness,
+            State& state,
+            const Container& genes,
+            const ChangeSet& changes,
+            double max_fraction = 0.5);
+
+
+/**
+ *  @short  An incremental fitness function for separable objectives f(x) = sum_i term(i, x_i), where term
+ *          is called with the index and value of each gene. Updating a child costs O(changed) term evaluations.
+ *
+ *  @note   Repeated incremental updates accumulate floating point error in the total; re-evaluate from
+ *          scratch periodically if this matters.
+ */
+template <typename Term>
+class Separable {
+public:
+    //! The cached partial state: the value of each term, and their total (the fitness)
+    struct State {
+        std::vector<double> terms;
+        double              fitness = 0.0;
+    };
+
+    explicit Separable(Term term) : m_term(std::move(term)) {}
+
+    //! @short  Evaluates every term of the objective.
+    template <typename Container>
+    [[nodiscard]] State evaluate(const Container& genes) const;
+
+    /**
+     *  @short  Re-evaluates only the terms of the genes that changed relative to the parent. The parent state
+     *          is taken by value, so move it in when it is no longer needed to avoid an O(n) copy.
+     */
+    template <typename Container>
+    [[nodiscard]] State evaluate(State parent_state, const Container& genes, const ChangeSet& changes) const;
+
+    //! @short  Updates the state in place, re-evaluating only the terms of the genes that changed.
+    template <typename Container>
+    void update(State& state, const Container& genes, const ChangeSet& changes) const;
+
+private:
+    Term m_term;
+};
+
+
+
+// --
+// Implementations
+template <typename Fitness, typename State, typename Container>
+State evaluate(const Fitness& fitness,
+               const State* parent_state,
+               const Container& genes,
+               const ChangeSet& changes,
+               double max_fraction) {
+    if (parent_state == nullptr ||
+        static_cast<double>(changes.count()) > max_fraction * static_cast<double>(genes.size())) {
+        return fitness.evaluate(genes);
+    }
+
+    return fitness.evaluate(*parent_state, genes, changes);
+}
+
+template <typename Fitness, typename State, typename Container>
+void update(const Fitness& fitness,
+            State& state,
+            const Container& genes,
+            const ChangeSet& changes,
+            double max_fraction) {
+    if (static_cast<double>(changes.count()) > max_fraction * static_cast<double>(genes.size())) {
+        state = fitness.evaluate(genes);
+        return;
+    }
+
+    fitness.update(state, genes, changes);
+}
+
+template <typename Term>
+template <typename Container>
+typename Separable<Term>::State Separable<Term>::evaluate(const Container& genes) const {
+    State out{}; out.terms.reserve(genes.size());
+
+    for (std::size_t i = 0; i < genes.size(); ++i) {
+        out.fitness += out.terms.emplace_back(m_term(i, genes[i].value()));
+    }
+
+    return out;
+}
+
+template <typename Term>
+template <typename Container>
+typename Separable<Term>::State Separable<Term>::evaluate(State parent_state,
+                                                          const Container& genes,
+                                                          const ChangeSet& changes) const {
+    update(parent_state, genes, changes);
+    return parent_state;
+}
+
+template <typename Term>
+template <typename Container>
+void Separable<Term>::update(State& state, const Container& genes, const ChangeSet& changes) const {
+    if (state.terms.size() != genes.size() || changes.size() != genes.size()) {
+        throw std::range_error("state does not match the size of the sequence");
+    }
+
+    // Replace the contribution of each changed gene
+    for (const auto i : changes.indices()) {
+        const auto term = m_term(i, genes[i].value());
+        state.fitness += term - state.terms[i];
+        state.terms[i] = term;
+    }
+}
+
+} // namespace moxie::Genetics::Incremental
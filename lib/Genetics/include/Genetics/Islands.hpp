@@ -0,0 +1,192 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  A multi-process island model, exchanging migrants over Unix-domain sockets (POSIX).
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+
+namespace moxie::Genetics::Islands {
+
+//! @short  A member of the population that is sent from one island to another.
+template <typename T>
+struct Migrant {
+    double         fitness;
+    std::vector<T> genes;
+};
+
+/**
+ *  @short  Encodes a batch of migrants in a compact binary format:
+ *          [count : u32][dimensions : u32] followed by count x ([fitness : f64][genes : T x dimensions]).
+ */
+template <typename T>
+[[nodiscard]] std::vector<std::byte> encode(const std::vector<Migrant<T>>& migrants);
+
+//! @short  Decodes a batch of migrants encoded with encode().
+template <typename T>
+[[nodiscard]] std::vector<Migrant<T>> decode(const std::vector<std::byte>& message);
+
+
+/**
+ *  @short  The handle a worker process uses to exchange migrants with the other islands. Islands are
+ *          connected in a ring: each island emigrates to the next island and immigrates from the previous one.
+ *
+ *          All operations are non-blocking, so migration never stalls evolution. Messages are split into
+ *          fragments small enough for the socket, and fragments that don't fit in the neighbour's queue are kept
+ *          in an outbox that every later send() / receive() / flush() continues draining. Only one message is in
+ *          flight at a time: a new message is dropped while the previous one is still in the outbox.
+ */
+class Island {
+public:
+    //! The largest payload sent in a single datagram (well below the default socket buffer size)
+    static constexpr std::size_t fragment_bytes = 32 * 1024;
+
+    ~Island();
+
+    Island(const Island& other) = delete;
+    Island& operator=(const Island& other) = delete;
+
+    [[nodiscard]] std::size_t index() const { return m_index; }
+    [[nodiscard]] std::size_t count() const { return m_count; }
+
+    /**
+     *  @short  Send a message to the next island. Returns false if the message was dropped because the
+     *          previous message is still being sent.
+     *
+     *  @throws std::system_error if the socket rejects a fragment for any reason other than a full queue
+     */
+    bool send(const std::vector<std::byte>& message);
+
+    //! @short  Send as much of the outbox as the neighbour's queue accepts. Returns true once the outbox is empty.
+    bool flush();
+
+    /**
+     *  @short  Receive every complete message from the previous island, waiting up to timeout_ms for the
+     *          first fragment. Fragments of a message that hasn't fully arrived are kept for the next call.
+     */
+    [[nodiscard]] std::vector<std::vector<std::byte>> receive(int timeout_ms = 0);
+
+    //! @short  Send a batch of migrants to the next island. Returns false if the batch was dropped.
+    template <typename T>
+    bool emigrate(const std::vector<Migrant<T>>& migrants) { return send(encode(migrants)); }
+
+    //! @short  Receive every pending migrant from the previous island.
+    template <typename T>
+    [[nodiscard]] std::vector<Migrant<T>> immigrate(int timeout_ms = 0);
+
+private:
+    friend class Coordinator;
+    Island(std::size_t index, std::size_t count, int out_fd, int in_fd);
+
+    std::size_t m_index;
+    std::size_t m_count;
+    int         m_out_fd;
+    int         m_in_fd;
+
+    std::deque<std::vector<std::byte>> m_outbox;                //! Fragments still to be sent
+    std::vector<std::byte>             m_inbox;                 //! The message being reassembled
+    std::uint32_t                      m_next_fragment = 0;     //! The fragment of m_inbox expected next
+};
+
+
+/**
+ *  @short  Spawns one worker process per island on the same host and waits for them to finish. Each worker
+ *          evolves its own population (e.g. with the Selection and Crossover components) and migrates
+ *          members through its Island handle.
+ */
+class Coordinator {
+public:
+    //! A worker returns its exit status (0 for success)
+    using Worker = std::function<int(Island&)>;
+
+    explicit Coordinator(std::size_t islands);
+
+    /**
+     *  @short  Run the worker in each island's process.
+     *
+     *  @returns the exit status of each island (a worker that throws exits with status 1)
+     */
+    [[nodiscard]] std::vector<int> run(const Worker& worker) const;
+
+private:
+    std::size_t m_islands;
+};
+
+
+
+// --
+// Implementations
+template <typename T>
+std::vector<std::byte> encode(const std::vector<Migrant<T>>& migrants) {
+    static_assert(std::is_trivially_copyable_v<T>, "genes must be trivially copyable to migrate");
+
+    const auto dimensions = migrants.empty() ? std::size_t{0} : migrants.front().genes.size();
+    const auto header     = std::array<std::uint32_t, 2>{static_cast<std::uint32_t>(migrants.size()),
+                                                         static_cast<std::uint32_t>(dimensions)};
+
+    std::vector<std::byte> out(sizeof(header) + migrants.size() * (sizeof(double) + dimensions * sizeof(T)));
+    auto* cursor = out.data();
+
+    std::memcpy(cursor, header.data(), sizeof(header)); cursor += sizeof(header);
+    for (const auto& migrant : migrants) {
+        if (migrant.genes.size() != dimensions) {
+            throw std::invalid_argument("all migrants must have the same number of genes");
+        }
+
+        std::memcpy(cursor, &migrant.fitness, sizeof(double));             cursor += sizeof(double);
+        std::memcpy(cursor, migrant.genes.data(), dimensions * sizeof(T)); cursor += dimensions * sizeof(T);
+    }
+
+    return out;
+}
+
+template <typename T>
+std::vector<Migrant<T>> decode(const std::vector<std::byte>& message) {
+    static_assert(std::is_trivially_copyable_v<T>, "genes must be trivially copyable to migrate");
+
+    std::array<std::uint32_t, 2> header{};
+    if (message.size() < sizeof(header)) { throw std::invalid_argument("message is too short to contain migrants"); }
+
+    const auto* cursor = message.data();
+    std::memcpy(header.data(), cursor, sizeof(header)); cursor += sizeof(header);
+
+    const std::size_t count = header[0], dimensions = header[1];
+    if (message.size() != sizeof(header) + count * (sizeof(double) + dimensions * sizeof(T))) {
+        throw std::invalid_argument("message size does not match its header");
+    }
+
+    std::vector<Migrant<T>> out{}; out.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto& migrant = out.emplace_back(Migrant<T>{0.0, std::vector<T>(dimensions)});
+
+        std::memcpy(&migrant.fitness, cursor, sizeof(double));             cursor += sizeof(double);
+        std::memcpy(migrant.genes.data(), cursor, dimensions * sizeof(T)); cursor += dimensions * sizeof(T);
+    }
+
+    return out;
+}
+
+template <typename T>
+std::vector<Migrant<T>> Island::immigrate(int timeout_ms) {
+    std::vector<Migrant<T>> out{};
+    for (const auto& message : receive(timeout_ms)) {
+        auto migrants = decode<T>(message);
+        std::move(migrants.begin(), migrants.end(), std::back_inserter(out));
+    }
+
+    return out;
+}
+
+} // namespace moxie::Genetics::Islands
@@ -0,0 +1,236 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  An out-of-core population backed by a memory-mapped file.
+ */
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Util/MappedFile.hpp"
+
+
+namespace moxie::Genetics {
+
+/**
+ *  @short  A population of fixed-length genomes stored as a row-major matrix of raw gene values in a
+ *          memory-mapped file, so the population may be larger than the available memory.
+ *
+ *          Only the fitness of each member is held in memory, so the index-based Selection functions
+ *          (truncate, tournament_selection, ...) can run on fitness() without touching any genome pages.
+ *          Evaluation and breeding stream over the file in chunks of rows, so each genome page is
+ *          touched about once per generation.
+ */
+template <typename T>
+class MappedPopulation {
+    static_assert(std::is_trivially_copyable_v<T>, "genes must be trivially copyable to be stored in a file");
+
+public:
+    //! The default number of bytes processed per chunk
+    static constexpr std::size_t default_chunk_bytes = std::size_t{1} << 22;
+
+    MappedPopulation(const std::string& path, std::size_t size, std::size_t dimensions);
+
+    [[nodiscard]] std::size_t size()       const { return m_size; }
+    [[nodiscard]] std::size_t dimensions() const { return m_dimensions; }
+
+    //! @short  Access the genes of the i'th member of the population.
+    [[nodiscard]] T*       row(std::size_t i)       { return data() + i * m_dimensions; }
+    [[nodiscard]] const T* row(std::size_t i) const { return data() + i * m_dimensions; }
+
+    //! @short  The fitness of each member of the population (as computed by the last call to evaluate).
+    [[nodiscard]] std::vector<double>&       fitness()       { return m_fitness; }
+    [[nodiscard]] const std::vector<double>& fitness() const { return m_fitness; }
+
+    /**
+     *  @short  Call fn(first_row, num_rows, rows) over consecutive chunks of the population, prefetching
+     *          the next chunk while the current one is processed.
+     */
+    template <typename Fn>
+    void for_each_chunk(Fn&& fn, std::size_t chunk_rows = 0);
+
+    //! @short  Compute fitness()[i] = fn(row(i), dimensions()) for every member, streaming over the file.
+    template <typename Fn>
+    void evaluate(Fn&& fn, std::size_t chunk_rows = 0);
+
+    /**
+     *  @short  Copy the selected members into consecutive rows of the next population, starting at row first.
+     *
+     *  @returns the row after the last one written
+     */
+    std::size_t gather(MappedPopulation& next,
+                       const std::vector<std::size_t>& selection,
+                       std::size_t first = 0) const;
+
+    /**
+     *  @short  Breed pairs of parents (selection[0] with selection[1], selection[2] with selection[3], ...)
+     *          by calling crossover(parent_a, parent_b, child_a, child_b, dimensions), writing the children
+     *          into consecutive rows of the next population starting at row first.
+     *
+     *  @returns the row after the last one written
+     */
+    template <typename Fn>
+    std::size_t breed(MappedPopulation& next,
+                      const std::vector<std::size_t>& selection,
+                      Fn&& crossover,
+                      std::size_t first = 0,
+                      std::size_t chunk_rows = 0) const;
+
+    //! @short  Flush the population to disk.
+    void sync() const { m_file.sync(); }
+
+private:
+    [[nodiscard]] T*       data()       { return static_cast<T*>(m_file.data()); }
+    [[nodiscard]] const T* data() const { return static_cast<const T*>(m_file.data()); }
+
+    [[nodiscard]] std::size_t row_bytes() const { return m_dimensions * sizeof(T); }
+    [[nodiscard]] std::size_t chunk_size(std::size_t chunk_rows) const;
+
+    void prefetch(std::size_t first, std::size_t count) const;
+
+    //! @short  Prefetch the rows selection[begin, end), coalesced into contiguous runs (one request per run).
+    void prefetch(const std::vector<std::size_t>& selection, std::size_t begin, std::size_t end) const;
+
+    std::size_t         m_size;
+    std::size_t         m_dimensions;
+    Util::MappedFile    m_file;
+    std::vector<double> m_fitness;
+};
+
+
+// --
+// Implementations
+template <typename T>
+MappedPopulation<T>::MappedPopulation(const std::string& path, std::size_t size, std::size_t dimensions)
+        : m_size(size),
+          m_dimensions(dimensions),
+          m_file(path, size * dimensions * sizeof(T)),
+          m_fitness(size, 0.0) {
+    // Parents are read in selection order (effectively random), so kernel readahead would mostly fetch rows
+    // nobody reads. Readahead is disabled, and every access path prefetches the rows it is about to read instead.
+    m_file.advise(Util::MappedFile::Advice::Random);
+}
+
+template <typename T>
+std::size_t MappedPopulation<T>::chunk_size(std::size_t chunk_rows) const {
+    if (chunk_rows != 0) return chunk_rows;
+    return std::max<std::size_t>(1, default_chunk_bytes / std::max<std::size_t>(1, row_bytes()));
+}
+
+template <typename T>
+void MappedPopulation<T>::prefetch(std::size_t first, std::size_t count) const {
+    m_file.advise(Util::MappedFile::Advice::WillNeed, first * row_bytes(), count * row_bytes());
+}
+
+template <typename T>
+void MappedPopulation<T>::prefetch(const std::vector<std::size_t>& selection, std::size_t begin, std::size_t end) const {
+    if (begin >= end) return;
+
+    std::vector<std::size_t> rows{selection.begin() + begin, selection.begin() + end};
+    std::sort(rows.begin(), rows.end());
+
+    // Parents selected more than once, or stored next to each other, share a single request
+    auto run = rows.front(), last = rows.front();
+    for (const auto i : rows) {
+        if (i > last + 1) {
+            prefetch(run, last - run + 1);
+            run = i;
+        }
+        last = i;
+    }
+    prefetch(run, last - run + 1);
+}
+
+template <typename T>
+template <typename Fn>
+void MappedPopulation<T>::for_each_chunk(Fn&& fn, std::size_t chunk_rows) {
+    const auto chunk = chunk_size(chunk_rows);
+
+    for (std::size_t first = 0; first < m_size; first += chunk) {
+        const auto count = std::min(chunk, m_size - first);
+
+        // Ask the OS to start reading the next chunk while we work on this one
+        if (first + count < m_size) prefetch(first + count, std::min(chunk, m_size - first - count));
+
+        fn(first, count, row(first));
+    }
+}
+
+template <typename T>
+template <typename Fn>
+void MappedPopulation<T>::evaluate(Fn&& fn, std::size_t chunk_rows) {
+    for_each_chunk([&](std::size_t first, std::size_t count, const T* rows) {
+        for (std::size_t i = 0; i < count; ++i) {
+            m_fitness[first + i] = fn(rows + i * m_dimensions, m_dimensions);
+        }
+    }, chunk_rows);
+}
+
+template <typename T>
+std::size_t MappedPopulation<T>::gather(MappedPopulation& next,
+                                        const std::vector<std::size_t>& selection,
+                                        std::size_t first) const {
+    // --
+    // Error check our inputs
+    if (next.dimensions() != m_dimensions) {
+        throw std::invalid_argument("populations must have the same number of dimensions");
+    } else if (first + selection.size() > next.size()) {
+        throw std::invalid_argument("selection does not fit in the next population");
+    }
+
+    for (const auto i : selection) {
+        if (i >= m_size) throw std::out_of_range("selected index is out of range of the population");
+
+        std::copy_n(row(i), m_dimensions, next.row(first));
+        next.fitness()[first] = m_fitness[i];
+        ++first;
+    }
+
+    return first;
+}
+
+template <typename T>
+template <typename Fn>
+std::size_t MappedPopulation<T>::breed(MappedPopulation& next,
+                                       const std::vector<std::size_t>& selection,
+                                       Fn&& crossover,
+                                       std::size_t first,
+                                       std::size_t chunk_rows) const {
+    // --
+    // Error check our inputs
+    if (next.dimensions() != m_dimensions) {
+        throw std::invalid_argument("populations must have the same number of dimensions");
+    } else if (selection.size() % 2 != 0) {
+        throw std::invalid_argument("selection must contain pairs of parents");
+    } else if (first + selection.size() > next.size()) {
+        throw std::invalid_argument("children do not fit in the next population");
+    } else if (std::any_of(selection.begin(), selection.end(), [&](auto i) { return i >= m_size; })) {
+        throw std::out_of_range("selected index is out of range of the population");
+    }
+
+    // Children are written sequentially, but parents are read in selection order, so each chunk of
+    // parents is prefetched one chunk ahead of the crossover
+    const auto chunk = chunk_size(chunk_rows) + chunk_size(chunk_rows) % 2;
+
+    prefetch(selection, 0, std::min(chunk, selection.size()));
+
+    for (std::size_t begin = 0; begin < selection.size(); begin += chunk) {
+        const auto end = std::min(begin + chunk, selection.size());
+
+        prefetch(selection, end, std::min(end + chunk, selection.size()));
+
+        for (std::size_t i = begin; i < end; i += 2) {
+            crossover(row(selection[i]), row(selection[i + 1]),
+                      next.row(first + i), next.row(first + i + 1),
+                      m_dimensions);
+        }
+    }
+
+    return first + selection.size();
+}
+
+} // namespace moxie::Genetics
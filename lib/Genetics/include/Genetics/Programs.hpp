@@ -0,0 +1,151 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  Linear genetic programming: postfix program genomes, and a batched stack interpreter.
+ */
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+namespace moxie::Genetics::Programs {
+
+//! @short  The operations a program is built from.
+enum class Opcode : std::uint16_t {
+    Constant,   //! Push a constant
+    Variable,   //! Push an input variable
+    Add,
+    Subtract,
+    Multiply,
+    Divide,     //! Protected division (x / 0 = 1)
+    Negate,
+    Sin,
+    Cos,
+};
+
+//! @short  Returns the number of operands the operation pops from the stack.
+[[nodiscard]] std::size_t arity(Opcode op);
+
+/**
+ *  @short  A single instruction of a program in postfix order. Each instruction is annotated with the size of the
+ *          subtree it roots, so the subtree of the instruction at i spans [i - size + 1, i].
+ */
+struct Instruction {
+    Opcode        op;
+    std::uint16_t variable = 0;     //! The input variable pushed by Opcode::Variable
+    std::uint32_t size     = 1;     //! The number of instructions in the subtree rooted at this instruction
+    double        constant = 0.0;   //! The constant pushed by Opcode::Constant
+};
+
+//! @short  A standalone program (a flat postfix sequence of instructions).
+using Program = std::vector<Instruction>;
+
+//! @short  A non-owning view of a program, either standalone or stored in an Arena.
+struct ProgramView {
+    const Instruction* data = nullptr;
+    std::size_t        size = 0;
+
+    ProgramView() = default;
+    ProgramView(const Instruction* data, std::size_t size) : data(data), size(size) {}
+    ProgramView(const Program& program) : data(program.data()), size(program.size()) {}
+
+    [[nodiscard]] const Instruction& operator[](std::size_t i) const { return data[i]; }
+    [[nodiscard]] const Instruction* begin() const { return data; }
+    [[nodiscard]] const Instruction* end()   const { return data + size; }
+};
+
+/**
+ *  @short  Stores the programs of a whole population back to back in a single flat buffer (an arena), so a
+ *          population is two allocations no matter how many programs it holds.
+ */
+class Arena {
+public:
+    [[nodiscard]] std::size_t size() const { return m_offsets.size() - 1; }
+
+    //! @short  Access the i'th program of the population.
+    [[nodiscard]] ProgramView operator[](std::size_t i) const {
+        return {m_instructions.data() + m_offsets[i], m_offsets[i + 1] - m_offsets[i]};
+    }
+
+    //! @short  Append a program to the arena, returning its index.
+    std::size_t add(ProgramView program);
+
+    //! @short  Remove every program, keeping the memory for the next generation.
+    void clear() { m_instructions.clear(); m_offsets.resize(1); }
+
+    void reserve(std::size_t programs, std::size_t instructions) {
+        m_offsets.reserve(programs + 1);
+        m_instructions.reserve(instructions);
+    }
+
+private:
+    std::vector<Instruction> m_instructions;
+    std::vector<std::size_t> m_offsets{0};
+};
+
+
+//! @short  The parameters used to grow random programs.
+struct Options {
+    std::size_t variables            = 1;       //! The number of input variables (at most 65536)
+    std::size_t max_depth            = 4;       //! The maximum depth of a grown (sub)tree
+    std::size_t max_length           = 256;     //! Children longer than this are replaced by a copy of their parent
+    double      terminal_probability = 0.3;     //! The probability a non-leaf position becomes a terminal anyway
+    double      constant_min         = -1.0;
+    double      constant_max         = 1.0;
+};
+
+/**
+ *  @short  Grows a random program using the "grow" method.
+ *
+ *  @throws std::invalid_argument if options.variables doesn't fit an Instruction's variable index
+ */
+[[nodiscard]] Program random_program(std::mt19937& rng, const Options& options);
+
+/**
+ *  @short  Returns the maximum stack depth reached when running the program.
+ *
+ *  @throws std::invalid_argument if the program is malformed (stack underflow, a bad size annotation, or it
+ *          doesn't leave exactly one value on the stack)
+ */
+[[nodiscard]] std::size_t stack_depth(ProgramView program);
+
+//! @short  Returns a copy of the program with the subtree rooted at point replaced by the replacement.
+[[nodiscard]] Program replace_subtree(ProgramView program, std::size_t point, ProgramView replacement);
+
+//! @short  Swaps a random subtree of each parent with a random subtree of the other.
+[[nodiscard]] std::pair<Program, Program> subtree_crossover(ProgramView parent_a,
+                                                            ProgramView parent_b,
+                                                            std::mt19937& rng,
+                                                            const Options& options);
+
+//! @short  Replaces a random subtree of the parent with a freshly grown one.
+[[nodiscard]] Program subtree_mutation(ProgramView parent, std::mt19937& rng, const Options& options);
+
+//! @short  Replaces a random instruction with another of the same arity (or perturbs a constant).
+[[nodiscard]] Program point_mutation(ProgramView parent, std::mt19937& rng, const Options& options);
+
+
+/**
+ *  @short  Runs programs over a whole batch of fitness cases. The stack holds a block of lanes cases per slot,
+ *          and every instruction is applied across the block at once, so the inner loops are vectorized.
+ */
+class Interpreter {
+public:
+    static constexpr std::size_t lanes = 8;
+
+    /**
+     *  @short  Evaluate the program on each fitness case, where inputs is a variable-major matrix
+     *          (inputs[v * cases + c] is variable v of case c).
+     */
+    void evaluate(ProgramView program,
+                  const std::vector<double>& inputs,
+                  std::size_t cases,
+                  std::vector<double>& outputs);
+
+private:
+    std::vector<double> m_stack;
+};
+
+} // namespace moxie::Genetics::Programs
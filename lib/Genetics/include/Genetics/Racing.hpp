@@ -0,0 +1,90 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  Racing evaluation of stochastic fitness functions.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <vector>
+
+
+namespace moxie::Genetics::Racing {
+
+//! @short  The budget and confidence of a race.
+struct Options {
+    std::size_t min_samples = 3;        //! Replications of each candidate before any can be decided
+    std::size_t max_samples = 30;       //! Replications of each candidate before the race gives up on it
+    std::size_t slice       = 1;        //! Replications of each undecided candidate per round
+    double      z           = 1.96;     //! Width of the confidence intervals, in standard errors
+};
+
+/**
+ *  @short  Races a population whose fitness (higher is better) is the mean of a stochastic fitness function.
+ *
+ *          Undecided candidates are sampled in slices of replications. After each round, a candidate is
+ *          eliminated once at least n others are confidently better than it (it cannot make the cut), and
+ *          accepted once fewer than n others could possibly be better than it (it certainly makes the cut).
+ *          Decided candidates stop consuming replications, so the budget is spent where the selection
+ *          decision is still uncertain.
+ */
+class Race {
+public:
+    //! The sampler returns one replication of the fitness of the given candidate
+    using Sampler = std::function<double(std::size_t candidate, std::size_t replication)>;
+
+    //! @short  Run a race between population_size candidates, of which n will be selected.
+    Race(const Sampler& sample, std::size_t population_size, std::size_t n, const Options& options = {});
+
+    //! @short  The estimated fitness of each candidate (the mean of its replications).
+    [[nodiscard]] const std::vector<double>& fitness() const { return m_mean; }
+
+    //! @short  The number of replications spent on each candidate.
+    [[nodiscard]] const std::vector<std::size_t>& samples() const { return m_samples; }
+
+    //! @short  The total number of replications spent on the race.
+    [[nodiscard]] std::size_t total_samples() const;
+
+    //! @short  Returns true if the candidate was eliminated before it exhausted its budget.
+    [[nodiscard]] bool eliminated(std::size_t i) const { return m_state[i] == State::Eliminated; }
+
+    //! @short  Returns true if the candidate was accepted before it exhausted its budget.
+    [[nodiscard]] bool accepted(std::size_t i) const { return m_state[i] == State::Accepted; }
+
+private:
+    enum class State { Racing, Accepted, Eliminated };
+
+    void add_sample(std::size_t i, double value);
+    [[nodiscard]] double standard_error(std::size_t i) const;
+    void decide(std::size_t n, double z);
+
+    std::vector<double>      m_mean;
+    std::vector<double>      m_m2;
+    std::vector<std::size_t> m_samples;
+    std::vector<State>       m_state;
+};
+
+
+//! @short  Returns the indices of the n most fit members of the population, racing their evaluation.
+[[nodiscard]] std::vector<std::size_t>
+        truncate(const Race::Sampler& sample,
+                 const std::size_t& population_size,
+                 const std::size_t& n,
+                 const Options& options = {});
+
+/**
+ *  @short  Returns the indices of n distinct members of the population, sampled by tournament selection
+ *          on fitness estimated by racing (the race concentrates its budget around the n best candidates).
+ */
+[[nodiscard]] std::vector<std::size_t>
+        tournament_selection(const Race::Sampler& sample,
+                             const std::size_t& population_size,
+                             const std::size_t& n,
+                             const std::size_t& k,
+                             double p,
+                             std::mt19937& rng,
+                             const Options& options = {});
+
+} // namespace moxie::Genetics::Racing
@@ -0,0 +1,104 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  A parallel reproduction stage.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Genetics/Crossover.hpp"
+#include "Util/Parallel.hpp"
+
+
+namespace moxie::Genetics::Reproduction {
+
+//! @short  Breeding at least this many pairs is split across threads (when threads is 0, i.e. automatic).
+static constexpr std::size_t parallel_threshold = 512;
+
+//! @short  The number of pairs bred from each random number stream.
+static constexpr std::size_t block_size = 64;
+
+/**
+ *  @short  Breeds pairs of parents from the population (parents[0] with parents[1], parents[2] with parents[3], ...)
+ *          by calling fn(splicer, rng, parent_a, parent_b) -> std::pair<T, T>, and moves the children into
+ *          the preassigned slots next[first], next[first + 1], ... of the next generation.
+ *
+ *          The pairs are partitioned into fixed blocks, and every block is bred from its own Splicer and rng
+ *          streams, seeded from (seed, block). Each thread owns its Splicer and rng and reseeds them per block,
+ *          so the children only depend on the seed, never on the number of threads.
+ *
+ *          When cpus is given, the breeding threads are pinned to them (see Util::parallel_for).
+ *
+ *  @note   population and next may be the same vector, as long as the children's slots don't overlap the parents.
+ */
+template <typename T, typename Breed>
+void breed(const std::vector<T>& population,
+           const std::vector<std::size_t>& parents,
+           std::vector<T>& next,
+           std::size_t first,
+           std::uint64_t seed,
+           Breed&& fn,
+           std::size_t threads = 0,
+           const std::vector<std::size_t>& cpus = {});
+
+
+// --
+// Implementations
+template <typename T, typename Breed>
+void breed(const std::vector<T>& population,
+           const std::vector<std::size_t>& parents,
+           std::vector<T>& next,
+           std::size_t first,
+           std::uint64_t seed,
+           Breed&& fn,
+           std::size_t threads,
+           const std::vector<std::size_t>& cpus) {
+    // --
+    // Error check our inputs
+    if (parents.size() % 2 != 0) {
+        throw std::invalid_argument("parents must be given in pairs");
+    } else if (first + parents.size() > next.size()) {
+        throw std::invalid_argument("children do not fit in the next generation");
+    }
+    for (const auto i : parents) {
+        if (i >= population.size()) throw std::out_of_range("parent index is out of range of the population");
+    }
+
+    const auto pairs  = parents.size() / 2;
+    const auto blocks = (pairs + block_size - 1) / block_size;
+    if (threads == 0) threads = Util::thread_count(pairs, parallel_threshold);
+
+    Util::parallel_for(blocks, threads, cpus, [&](std::size_t, std::size_t begin, std::size_t end) {
+        // Each thread owns its splicer and rng, which are reseeded for each block it breeds
+        std::seed_seq unseeded{};
+        Crossover::Splicer splicer{unseeded};
+        std::mt19937 rng{};
+
+        const auto lo = static_cast<std::uint32_t>(seed), hi = static_cast<std::uint32_t>(seed >> 32);
+
+        for (std::size_t block = begin; block < end; ++block) {
+            const auto b_lo = static_cast<std::uint32_t>(block), b_hi = static_cast<std::uint32_t>(std::uint64_t{block} >> 32);
+
+            std::seed_seq splicer_seed{lo, hi, b_lo, b_hi, 0u};
+            std::seed_seq rng_seed{lo, hi, b_lo, b_hi, 1u};
+            splicer.seed(splicer_seed);
+            rng.seed(rng_seed);
+
+            const auto last = std::min(pairs, (block + 1) * block_size);
+            for (auto pair = block * block_size; pair < last; ++pair) {
+                auto children = fn(splicer, rng, population[parents[2 * pair]], population[parents[2 * pair + 1]]);
+
+                next[first + 2 * pair]     = std::move(children.first);
+                next[first + 2 * pair + 1] = std::move(children.second);
+            }
+        }
+    });
+}
+
+} // namespace moxie::Genetics::Reproduction
@@ -0,0 +1,67 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  Fitness scaling algorithms.
+ */
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+
+namespace moxie::Genetics::Scaling {
+
+/**
+ *  @short  Populations of at least this size are scaled in parallel (when threads is 0, i.e. automatic).
+ *
+ *  @note   Every function below works in-place on the caller's buffer, and fuses its reductions into as few
+ *          passes over the buffer as possible. Passing threads = 1 forces a serial scaling, and passing
+ *          cpus pins the threads (see Util::parallel_for), so each scans the slice it first touched.
+ */
+static constexpr std::size_t parallel_threshold = 1'000'000;
+
+//! @short  Convert objective values (lower is better) to fitness values (higher is better), i.e. max - value.
+void objective(std::vector<double>& values, std::size_t threads = 0, const std::vector<std::size_t>& cpus = {});
+
+//! @short  Normalize the fitness values so their sum totals 1.
+void normalize(std::vector<double>& fitness, std::size_t threads = 0, const std::vector<std::size_t>& cpus = {});
+
+/**
+ *  @short  Linear scaling f' = a * f + b, chosen so the average fitness is preserved and the best member
+ *          has c times the average fitness (reduced when that would make any fitness negative).
+ */
+void linear(std::vector<double>& fitness, double c = 2.0, std::size_t threads = 0, const std::vector<std::size_t>& cpus = {});
+
+//! @short  Sigma truncation f' = max(0, f - (mean - c * sigma)).
+void sigma_truncation(std::vector<double>& fitness, double c = 2.0, std::size_t threads = 0, const std::vector<std::size_t>& cpus = {});
+
+/**
+ *  @short  Linear ranking: the worst member gets 2 - pressure and the best gets pressure, for a selective
+ *          pressure in [1, 2]. Ties are broken by index so the result doesn't depend on the thread count.
+ */
+void rank(std::vector<double>& fitness, double pressure = 2.0, std::size_t threads = 0, const std::vector<std::size_t>& cpus = {});
+
+//! @short  Boltzmann scaling f' = exp(f / temperature), normalized so the average fitness is 1.
+void boltzmann(std::vector<double>& fitness, double temperature, std::size_t threads = 0, const std::vector<std::size_t>& cpus = {});
+
+//! @short  Windowing f' = max(0, f - baseline), where the baseline is typically provided by a Window.
+void windowing(std::vector<double>& fitness, double baseline, std::size_t threads = 0, const std::vector<std::size_t>& cpus = {});
+
+
+/**
+ *  @short  Tracks the minimum fitness over the last few generations, to provide the baseline for windowing.
+ */
+class Window {
+public:
+    explicit Window(std::size_t generations);
+
+    //! @short  Record the fitness of the current generation, and return the minimum over the window.
+    double update(const std::vector<double>& fitness);
+
+private:
+    std::size_t        m_generations;
+    std::deque<double> m_minima;
+};
+
+} // namespace moxie::Genetics::Scaling
@@ -7,15 +7,21 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
+#include <numeric>
 #include <random>
+#include <stdexcept>
+#include <vector>
 
 
 namespace moxie::Genetics::Selection {
 
 //! @short  Convert an array of objective values (lower is better) to relative fitness values (higher is better)
+//! @see    Scaling::objective to convert the values in-place
 [[nodiscard]] std::vector<double> objective_value_fitness(const std::vector<double>& values);
 
 //! @short  Normalize the vector of fitness so their sum totals 1.
+//! @see    Scaling::normalize to normalize the fitness in-place
 [[nodiscard]] std::vector<double> normalize_fitness(const std::vector<double>& fitness);
 
 
@@ -71,6 +77,12 @@ template <typename T>
                            const std::size_t& n,
                            std::mt19937& rng);
 
+//! @short  Sample the indices of n members of a population uniformly at random (without replacement).
+[[nodiscard]] std::vector<std::size_t>
+        universal_sampling(const std::size_t& population_size,
+                           const std::size_t& n,
+                           std::mt19937& rng);
+
 /**
  *  @short  Returns the n most fit members of the population.
  */
@@ -88,10 +100,84 @@ template <typename T>
                  const std::size_t& n);
 
 
+// --
+// Zero-copy access to the selected members of the population
+
+//! @short  A lightweight, non-owning view of the selected members of a population.
+template <typename T>
+using SelectionView = std::vector<std::reference_wrapper<const T>>;
+
+/**
+ *  @short  Returns references to the selected members of the population (in selection order), without
+ *          copying them. The view is invalidated if the population is modified.
+ */
+template <typename T>
+[[nodiscard]] SelectionView<T>
+        view(const std::vector<T>& population,
+             const std::vector<std::size_t>& selection);
+
+/**
+ *  @short  Permutes the population in-place so the selected members are contiguous at the front (in selection
+ *          order). Members are only ever swapped, never copied, and the selection must contain distinct indices.
+ *
+ *  @returns the number of selected members, i.e. the survivors are [population.begin(), population.begin() + n)
+ */
+template <typename T>
+std::size_t
+        compact(std::vector<T>& population,
+                const std::vector<std::size_t>& selection);
+
+
 
 // --
 // Function definitions to follow
 
+template <typename T>
+SelectionView<T> view(const std::vector<T>& population,
+                      const std::vector<std::size_t>& selection) {
+    SelectionView<T> out{}; out.reserve(selection.size());
+    std::for_each(selection.begin(), selection.end(), [&](auto i) { out.emplace_back(population.at(i)); });
+
+    return out;
+}
+
+template <typename T>
+std::size_t compact(std::vector<T>& population,
+                    const std::vector<std::size_t>& selection) {
+    // --
+    // Error check our inputs
+    if (selection.size() > population.size()) { throw std::invalid_argument("selection cannot be larger than population size"); }
+
+    // The whole selection is validated before anything moves, so a bad index leaves the population untouched
+    std::vector<bool> seen(population.size(), false);
+    for (const auto i : selection) {
+        if (i >= population.size()) { throw std::out_of_range("selected index is out of range of the population"); }
+        if (seen[i]) { throw std::invalid_argument("selection cannot contain duplicate indices"); }
+        seen[i] = true;
+    }
+
+    // Track where each original member currently lives (and which original member occupies each slot)
+    std::vector<std::size_t> position(population.size()), occupant(population.size());
+    std::iota(position.begin(), position.end(), 0);
+    std::iota(occupant.begin(), occupant.end(), 0);
+
+    for (std::size_t dst = 0; dst < selection.size(); ++dst) {
+        const auto i   = selection[dst];
+        const auto src = position[i];
+
+        // Swap the selected member into place, and record where the displaced member went
+        using std::swap;
+        swap(population[dst], population[src]);
+
+        const auto displaced = occupant[dst];
+        position[displaced] = src; occupant[src] = displaced;
+        position[i]         = dst; occupant[dst] = i;
+    }
+
+    return selection.size();
+}
+
+
 template <typename T>
 std::vector<T> universal_sampling(const std::vector<T>& population,
                                   const std::size_t& n,
@@ -112,14 +198,9 @@ template <typename T>
 std::vector<T> truncate(const std::vector<T>& population,
                         const std::vector<double>& fitness,
                         const std::size_t& n) {
-    // Perform the selection
-    const auto selection = truncate(fitness, n);
-
-    // Copy the selected members of the population to the output container
-    std::vector<T> out; out.reserve(n);
-    std::for_each(selection.begin(), selection.end(), [&](auto i) { out.push_back(population[i]); });
-
-    return out;
+    // Perform the selection, and copy the selected members to the output container
+    const auto selection = view(population, truncate(fitness, n));
+    return {selection.begin(), selection.end()};
 }
 
 template <typename T>
@@ -127,14 +208,9 @@ std::vector<T> proportional_selection(const std::vector<T>& population,
                                       const std::vector<double>& fitness,
                                       const std::size_t& n,
                                       std::mt19937& rng) {
-    // Perform the selection
-    const auto selection = proportional_selection(fitness, n, rng);
-
-    // Copy the selected members of the population to the output container
-    std::vector<T> out; out.reserve(n);
-    std::for_each(selection.begin(), selection.end(), [&](auto i) { out.push_back(population[i]); });
-
-    return out;
+    // Perform the selection, and copy the selected members to the output container
+    const auto selection = view(population, proportional_selection(fitness, n, rng));
+    return {selection.begin(), selection.end()};
 }
 
 template <typename T>
@@ -144,14 +220,9 @@ std::vector<T> tournament_selection(const std::vector<T>& population,
                                     const std::size_t& k,
                                     double p,
                                     std::mt19937& rng) {
-    // Perform the selection
-    const auto selection = tournament_selection(fitness, n, k, p, rng);
-
-    // Copy the selected members of the population to the output container
-    std::vector<T> out; out.reserve(n);
-    std::for_each(selection.begin(), selection.end(), [&](auto i) { out.push_back(population[i]); });
-
-    return out;
+    // Perform the selection, and copy the selected members to the output container
+    const auto selection = view(population, tournament_selection(fitness, n, k, p, rng));
+    return {selection.begin(), selection.end()};
 }
 
 
@@ -0,0 +1,89 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  Surrogate-assisted pre-screening of offspring.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Util/KDTree.hpp"
+
+
+namespace moxie::Genetics::Surrogate {
+
+//! @short  The number of offspring screened, and the number that went on to a true evaluation.
+struct Statistics {
+    std::size_t screened  = 0;
+    std::size_t evaluated = 0;
+
+    //! @short  The fraction of true evaluations that were avoided.
+    [[nodiscard]] double savings() const {
+        return screened == 0 ? 0.0 : 1.0 - static_cast<double>(evaluated) / static_cast<double>(screened);
+    }
+};
+
+/**
+ *  @short  Keeps an archive of evaluated (genome, fitness) pairs in a k-d tree, and uses inverse-distance
+ *          weighted k-nearest-neighbour regression to predict the fitness (higher is better) of offspring,
+ *          so only the most promising offspring go on to a true evaluation.
+ */
+class Screener {
+public:
+    explicit Screener(std::size_t dimensions, std::size_t k = 5);
+
+    //! @short  The number of evaluated genomes in the archive.
+    [[nodiscard]] std::size_t size() const { return m_fitness.size(); }
+
+    //! @short  Add a truly evaluated genome to the archive (the index is updated incrementally).
+    void add(const std::vector<double>& genes, double fitness);
+
+    //! @short  Predict the fitness of a genome from its nearest neighbours in the archive.
+    [[nodiscard]] double predict(const std::vector<double>& genes) const;
+
+    /**
+     *  @short  Returns the indices of the offspring with the best predicted fitness (the given fraction of
+     *          them, rounded up), which should go on to a true evaluation.
+     *
+     *  @note   Until the archive holds at least k genomes every offspring is passed through.
+     */
+    [[nodiscard]] std::vector<std::size_t> screen(const std::vector<std::vector<double>>& offspring, double fraction);
+
+    //! @short  Screens offspring whose genes are sequences of Genome (the projection maps a member to its genes).
+    template <typename T, typename Projection>
+    [[nodiscard]] std::vector<std::size_t> screen(const std::vector<T>& offspring, double fraction, Projection projection);
+
+    [[nodiscard]] const Statistics& statistics() const { return m_statistics; }
+
+private:
+    std::size_t         m_k;
+    Util::KDTree        m_index;
+    std::vector<double> m_fitness;
+    Statistics          m_statistics;
+};
+
+//! @short  Converts a sequence of genes to a point for the surrogate model.
+template <typename Container>
+[[nodiscard]] std::vector<double> to_point(const Container& sequence);
+
+
+// --
+// Implementations
+template <typename Container>
+std::vector<double> to_point(const Container& sequence) {
+    std::vector<double> out{}; out.reserve(sequence.size());
+    for (const auto& gene : sequence) out.push_back(static_cast<double>(gene.value()));
+
+    return out;
+}
+
+template <typename T, typename Projection>
+std::vector<std::size_t> Screener::screen(const std::vector<T>& offspring, double fraction, Projection projection) {
+    std::vector<std::vector<double>> points{}; points.reserve(offspring.size());
+    for (const auto& member : offspring) points.push_back(to_point(projection(member)));
+
+    return screen(points, fraction);
+}
+
+} // namespace moxie::Genetics::Surrogate
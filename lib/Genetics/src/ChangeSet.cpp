@@ -0,0 +1,52 @@
+#include "Genetics/ChangeSet.hpp"
+
+#include <bitset>
+
+
+namespace moxie::Genetics {
+
+namespace {
+
+//! @short  Returns the index of the lowest set bit of a non-zero word.
+std::size_t lowest_set_bit(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+    // The bits below the lowest set bit, counted
+    return std::bitset<64>{(word & (~word + 1)) - 1}.count();
+#endif
+}
+
+}
+
+std::size_t ChangeSet::count() const {
+    std::size_t out = 0;
+    for (const auto word : m_words) out += std::bitset<64>{word}.count();
+
+    return out;
+}
+
+std::vector<std::size_t> ChangeSet::indices() const {
+    std::vector<std::size_t> out{}; out.reserve(count());
+
+    // Visit only the set bits of each word, clearing the lowest set bit on each iteration
+    for (std::size_t w = 0; w < m_words.size(); ++w) {
+        for (auto word = m_words[w]; word != 0; word &= word - 1) {
+            out.push_back(w * 64 + lowest_set_bit(word));
+        }
+    }
+
+    return out;
+}
+
+ChangeSet& ChangeSet::operator|=(const ChangeSet& other) {
+    if (other.size() != m_size) {
+        throw std::range_error("cannot merge change sets of different sizes");
+    }
+
+    for (std::size_t w = 0; w < m_words.size(); ++w) m_words[w] |= other.m_words[w];
+
+    return *this;
+}
+
+} // namespace moxie::Genetics
@@ -8,4 +8,6 @@ Splicer::Splicer() {
     m_rng = std::mt19937{seed};
 }
 
+Splicer::Splicer(std::seed_seq& seed) : m_rng(seed) {}
+
 } // namespace moxie::Genetics::Crossover
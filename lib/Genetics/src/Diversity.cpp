@@ -0,0 +1,74 @@
+#include "Genetics/Diversity.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+
+namespace moxie::Genetics::Diversity {
+
+std::vector<double> gene_variance(const std::vector<double>& genes, std::size_t dimensions) {
+    // --
+    // Error check our inputs
+    if (dimensions == 0) {
+        throw std::invalid_argument("dimensions must be greater than 0");
+    } else if (genes.size() % dimensions != 0) {
+        throw std::invalid_argument("genes must contain a whole number of rows");
+    }
+
+    const auto rows = genes.size() / dimensions;
+
+    std::vector<double> mean(dimensions, 0.0), variance(dimensions, 0.0);
+    if (rows == 0) return variance;
+
+    // --
+    // Two passes over the matrix (mean, then squared deviation). The inner loops run over contiguous
+    // columns with no dependencies between them, so the compiler can vectorize them.
+    for (std::size_t r = 0; r < rows; ++r) {
+        const auto* row = genes.data() + r * dimensions;
+        for (std::size_t d = 0; d < dimensions; ++d) mean[d] += row[d];
+    }
+
+    const auto scale = 1.0 / static_cast<double>(rows);
+    for (std::size_t d = 0; d < dimensions; ++d) mean[d] *= scale;
+
+    for (std::size_t r = 0; r < rows; ++r) {
+        const auto* row = genes.data() + r * dimensions;
+        for (std::size_t d = 0; d < dimensions; ++d) {
+            const auto deviation = row[d] - mean[d];
+            variance[d] += deviation * deviation;
+        }
+    }
+
+    for (std::size_t d = 0; d < dimensions; ++d) variance[d] *= scale;
+
+    return variance;
+}
+
+double mean_pairwise_distance(const std::vector<double>& variance, std::size_t population_size) {
+    if (population_size < 2) return 0.0;
+
+    // Average over the n (n - 1) / 2 distinct pairs, rather than over all n^2 (including i == j)
+    const auto n = static_cast<double>(population_size);
+    return std::sqrt(2.0 * std::accumulate(variance.begin(), variance.end(), 0.0) * n / (n - 1.0));
+}
+
+double adaptive_mutation_rate(double diversity,
+                              double target_diversity,
+                              double base_rate,
+                              double min_rate,
+                              double max_rate) {
+    // --
+    // Error check our inputs
+    if (target_diversity <= 0) {
+        throw std::invalid_argument("target diversity must be greater than 0");
+    } else if (min_rate > max_rate) {
+        throw std::invalid_argument("min rate cannot be greater than max rate");
+    }
+
+    // A collapsed population (no diversity) mutates at the maximum rate
+    if (diversity <= 0) return max_rate;
+
+    return std::clamp(base_rate * (target_diversity / diversity), min_rate, max_rate);
+}
+
+} // namespace moxie::Genetics::Diversity
@@ -0,0 +1,238 @@
+#include "Genetics/Islands.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <system_error>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+
+namespace moxie::Genetics::Islands {
+
+namespace {
+
+[[noreturn]] void throw_error(int error, const char* what) {
+    throw std::system_error(error, std::generic_category(), what);
+}
+
+[[noreturn]] void throw_errno(const char* what) {
+    throw_error(errno, what);
+}
+
+void set_non_blocking(int fd) {
+    const auto flags = ::fcntl(fd, F_GETFL);
+    if (flags < 0 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+        throw_errno("failed to make socket non-blocking");
+    }
+}
+
+}
+
+Island::Island(std::size_t index, std::size_t count, int out_fd, int in_fd)
+        : m_index(index), m_count(count), m_out_fd(out_fd), m_in_fd(in_fd) {}
+
+Island::~Island() {
+    ::close(m_out_fd);
+    ::close(m_in_fd);
+}
+
+bool Island::send(const std::vector<std::byte>& message) {
+    if (!flush()) return false;
+
+    // Each fragment is prefixed with its index and the number of fragments in the message
+    const auto fragments = std::max<std::size_t>(1, (message.size() + fragment_bytes - 1) / fragment_bytes);
+    if (fragments > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("message is too large to send");
+    }
+
+    for (std::size_t f = 0; f < fragments; ++f) {
+        const auto begin = std::min(message.size(), f * fragment_bytes);
+        const auto end   = std::min(message.size(), begin + fragment_bytes);
+        const auto header = std::array<std::uint32_t, 2>{static_cast<std::uint32_t>(f),
+                                                         static_cast<std::uint32_t>(fragments)};
+
+        auto& fragment = m_outbox.emplace_back(sizeof(header) + (end - begin));
+        std::memcpy(fragment.data(), header.data(), sizeof(header));
+        std::copy(message.begin() + begin, message.begin() + end, fragment.begin() + sizeof(header));
+    }
+
+    flush();
+    return true;
+}
+
+bool Island::flush() {
+    while (!m_outbox.empty()) {
+        const auto& fragment = m_outbox.front();
+        if (::send(m_out_fd, fragment.data(), fragment.size(), MSG_DONTWAIT | MSG_NOSIGNAL) < 0) {
+            // A full queue (slow neighbour) leaves the rest of the outbox for later
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) return false;
+
+            // A finished neighbour will never receive the rest of the message
+            if (errno == ECONNREFUSED || errno == EPIPE) {
+                m_outbox.clear();
+                return true;
+            }
+
+            // Anything else (including EMSGSIZE) is a real failure, not a dropped batch
+            throw_errno("failed to send migrants");
+        }
+
+        m_outbox.pop_front();
+    }
+
+    return true;
+}
+
+std::vector<std::vector<std::byte>> Island::receive(int timeout_ms) {
+    std::vector<std::vector<std::byte>> out{};
+
+    // Receiving is also an opportunity to make progress on our own outbox
+    flush();
+
+    if (timeout_ms != 0) {
+        pollfd fd{m_in_fd, POLLIN, 0};
+        if (::poll(&fd, 1, timeout_ms) < 0 && errno != EINTR) throw_errno("failed to poll for migrants");
+    }
+
+    std::array<std::uint32_t, 2> header{};
+    std::vector<std::byte> fragment(sizeof(header) + fragment_bytes);
+
+    while (true) {
+        const auto size = ::recv(m_in_fd, fragment.data(), fragment.size(), MSG_DONTWAIT | MSG_TRUNC);
+        if (size < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            throw_errno("failed to receive migrants");
+        }
+
+        if (static_cast<std::size_t>(size) < sizeof(header) || static_cast<std::size_t>(size) > fragment.size()) {
+            throw std::invalid_argument("received a malformed fragment");
+        }
+        std::memcpy(header.data(), fragment.data(), sizeof(header));
+
+        const auto [index, fragments] = header;
+
+        // Fragments arrive in order, so a fragment that doesn't continue the current message starts a new one
+        if (index == 0) {
+            m_inbox.clear();
+        } else if (index != m_next_fragment) {
+            m_inbox.clear();
+            m_next_fragment = 0;
+            continue;
+        }
+
+        m_inbox.insert(m_inbox.end(), fragment.begin() + sizeof(header), fragment.begin() + size);
+        m_next_fragment = index + 1;
+
+        if (m_next_fragment == fragments) {
+            out.push_back(std::move(m_inbox));
+            m_inbox.clear();
+            m_next_fragment = 0;
+        }
+    }
+
+    flush();
+    return out;
+}
+
+
+Coordinator::Coordinator(std::size_t islands) : m_islands(islands) {
+    if (islands == 0) { throw std::invalid_argument("there must be at least 1 island"); }
+}
+
+std::vector<int> Coordinator::run(const Worker& worker) const {
+    // --
+    // Connect the islands in a ring: island i writes to channels[i] and reads from channels[i - 1]
+    std::vector<std::array<int, 2>> channels(m_islands, {-1, -1});
+
+    auto close_all = [&]() {
+        for (const auto& channel : channels) {
+            for (const auto fd : channel) { if (fd >= 0) ::close(fd); }
+        }
+    };
+
+    for (auto& channel : channels) {
+        if (::socketpair(AF_UNIX, SOCK_DGRAM, 0, channel.data()) != 0) {
+            // close() may overwrite errno, so keep the original failure
+            const int error = errno;
+            channel = {-1, -1};
+            close_all();
+            throw_error(error, "failed to create socket pair");
+        }
+
+        try {
+            set_non_blocking(channel[0]);
+            set_non_blocking(channel[1]);
+        } catch (...) {
+            close_all();
+            throw;
+        }
+    }
+
+    // Flush buffered output so it isn't duplicated in each worker
+    std::fflush(nullptr);
+
+    std::vector<pid_t> workers{};
+    for (std::size_t i = 0; i < m_islands; ++i) {
+        const auto pid = ::fork();
+        if (pid < 0) {
+            const int error = errno;
+            close_all();
+
+            // Don't leave the islands spawned so far running (or as zombies) behind
+            for (const auto worker_pid : workers) ::kill(worker_pid, SIGTERM);
+            for (const auto worker_pid : workers) {
+                while (::waitpid(worker_pid, nullptr, 0) < 0 && errno == EINTR) {}
+            }
+
+            throw_error(error, "failed to spawn island");
+        }
+
+        if (pid == 0) {
+            // --
+            // This is the worker process; keep only this island's ends of the ring
+            const auto out_fd = ::dup(channels[i][0]);
+            const auto in_fd  = ::dup(channels[(i + m_islands - 1) % m_islands][1]);
+            close_all();
+
+            int status = 1;
+            try {
+                Island island{i, m_islands, out_fd, in_fd};
+                status = worker(island);
+            } catch (...) {
+                status = 1;
+            }
+
+            std::fflush(nullptr);
+            ::_exit(status);
+        }
+
+        workers.push_back(pid);
+    }
+
+    close_all();
+
+    // --
+    // Wait for every island to finish (each island evolves independently, so the order doesn't matter)
+    std::vector<int> statuses{};
+    for (const auto pid : workers) {
+        int status = 0;
+        while (::waitpid(pid, &status, 0) < 0) {
+            if (errno != EINTR) throw_errno("failed to wait for island");
+        }
+
+        statuses.push_back(WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status));
+    }
+
+    return statuses;
+}
+
+} // namespace moxie::Genetics::Islands
@@ -0,0 +1,288 @@
+#include "Genetics/Programs.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+
+namespace moxie::Genetics::Programs {
+
+namespace {
+
+constexpr Opcode functions[] = {
+    Opcode::Add, Opcode::Subtract, Opcode::Multiply, Opcode::Divide, Opcode::Negate, Opcode::Sin, Opcode::Cos,
+};
+
+constexpr Opcode unary[]  = {Opcode::Negate, Opcode::Sin, Opcode::Cos};
+constexpr Opcode binary[] = {Opcode::Add, Opcode::Subtract, Opcode::Multiply, Opcode::Divide};
+
+//! Instructions store the variable index in 16 bits, so larger variable counts would silently truncate
+void check_options(const Options& options) {
+    if (options.variables > std::size_t{std::numeric_limits<std::uint16_t>::max()} + 1) {
+        throw std::invalid_argument("programs support at most 65536 variables");
+    }
+}
+
+Instruction random_terminal(std::mt19937& rng, const Options& options) {
+    std::bernoulli_distribution coin{0.5};
+
+    if (options.variables > 0 && coin(rng)) {
+        std::uniform_int_distribution<std::size_t> variable{0, options.variables - 1};
+        return {Opcode::Variable, static_cast<std::uint16_t>(variable(rng))};
+    }
+
+    std::uniform_real_distribution<double> constant{options.constant_min, options.constant_max};
+    return {Opcode::Constant, 0, 1, constant(rng)};
+}
+
+void grow(Program& out, std::size_t depth, std::mt19937& rng, const Options& options) {
+    std::bernoulli_distribution terminal{options.terminal_probability};
+
+    if (depth == 0 || terminal(rng)) {
+        out.push_back(random_terminal(rng, options));
+        return;
+    }
+
+    std::uniform_int_distribution<std::size_t> pick{0, std::size(functions) - 1};
+    const auto op    = functions[pick(rng)];
+    const auto start = out.size();
+
+    // Operands are emitted first, so the operation closes the subtree in postfix order
+    for (std::size_t i = 0; i < arity(op); ++i) grow(out, depth - 1, rng, options);
+
+    out.push_back({op, 0, static_cast<std::uint32_t>(out.size() - start + 1)});
+}
+
+std::size_t random_point(ProgramView program, std::mt19937& rng) {
+    if (program.size == 0) { throw std::invalid_argument("program must not be empty"); }
+
+    std::uniform_int_distribution<std::size_t> distrib{0, program.size - 1};
+    return distrib(rng);
+}
+
+} // namespace
+
+
+std::size_t arity(Opcode op) {
+    switch (op) {
+        case Opcode::Constant:
+        case Opcode::Variable:
+            return 0;
+        case Opcode::Negate:
+        case Opcode::Sin:
+        case Opcode::Cos:
+            return 1;
+        case Opcode::Add:
+        case Opcode::Subtract:
+        case Opcode::Multiply:
+        case Opcode::Divide:
+            return 2;
+    }
+    throw std::invalid_argument("unknown opcode");
+}
+
+std::size_t Arena::add(ProgramView program) {
+    m_instructions.insert(m_instructions.end(), program.begin(), program.end());
+    m_offsets.push_back(m_instructions.size());
+    return size() - 1;
+}
+
+Program random_program(std::mt19937& rng, const Options& options) {
+    check_options(options);
+
+    Program out;
+    grow(out, options.max_depth, rng, options);
+    return out;
+}
+
+std::size_t stack_depth(ProgramView program) {
+    std::size_t depth = 0, max_depth = 0;
+
+    for (std::size_t i = 0; i < program.size; ++i) {
+        const auto& instruction = program[i];
+        const auto n = arity(instruction.op);
+
+        if (depth < n) { throw std::invalid_argument("program underflows the stack"); }
+        if (instruction.size == 0 || instruction.size > i + 1) {
+            throw std::invalid_argument("program has a bad subtree size");
+        }
+
+        // The operands are the subtrees immediately preceding this instruction
+        std::size_t expected = 1;
+        for (std::size_t j = 0; j < n; ++j) {
+            if (i < expected) { throw std::invalid_argument("program has a bad subtree size"); }
+            expected += program[i - expected].size;
+        }
+        if (expected != instruction.size) { throw std::invalid_argument("program has a bad subtree size"); }
+
+        depth = depth - n + 1;
+        max_depth = std::max(max_depth, depth);
+    }
+
+    if (depth != 1) { throw std::invalid_argument("program must leave exactly one value on the stack"); }
+
+    return max_depth;
+}
+
+Program replace_subtree(ProgramView program, std::size_t point, ProgramView replacement) {
+    // --
+    // Error check our inputs
+    if (point >= program.size) { throw std::out_of_range("point is out of range"); }
+    if (replacement.size == 0) { throw std::invalid_argument("replacement must not be empty"); }
+
+    const auto start = point + 1 - program[point].size;
+    const auto delta = static_cast<std::int64_t>(replacement.size) - static_cast<std::int64_t>(program[point].size);
+
+    Program out;
+    out.reserve(program.size + replacement.size - program[point].size);
+    out.insert(out.end(), program.begin(), program.begin() + start);
+    out.insert(out.end(), replacement.begin(), replacement.end());
+
+    // Only instructions after the subtree can be its ancestors, and their sizes grow (or shrink) by the difference
+    for (std::size_t k = point + 1; k < program.size; ++k) {
+        auto instruction = program[k];
+        if (k + 1 - instruction.size <= start) {
+            instruction.size = static_cast<std::uint32_t>(instruction.size + delta);
+        }
+        out.push_back(instruction);
+    }
+
+    return out;
+}
+
+std::pair<Program, Program> subtree_crossover(ProgramView parent_a,
+                                              ProgramView parent_b,
+                                              std::mt19937& rng,
+                                              const Options& options) {
+    const auto point_a = random_point(parent_a, rng);
+    const auto point_b = random_point(parent_b, rng);
+
+    const auto subtree_a = ProgramView{parent_a.data + point_a + 1 - parent_a[point_a].size, parent_a[point_a].size};
+    const auto subtree_b = ProgramView{parent_b.data + point_b + 1 - parent_b[point_b].size, parent_b[point_b].size};
+
+    auto child_a = (parent_a.size - subtree_a.size + subtree_b.size <= options.max_length)
+        ? replace_subtree(parent_a, point_a, subtree_b)
+        : Program(parent_a.begin(), parent_a.end());
+
+    auto child_b = (parent_b.size - subtree_b.size + subtree_a.size <= options.max_length)
+        ? replace_subtree(parent_b, point_b, subtree_a)
+        : Program(parent_b.begin(), parent_b.end());
+
+    return {std::move(child_a), std::move(child_b)};
+}
+
+Program subtree_mutation(ProgramView parent, std::mt19937& rng, const Options& options) {
+    const auto point   = random_point(parent, rng);
+    const auto subtree = random_program(rng, options);
+
+    if (parent.size - parent[point].size + subtree.size() > options.max_length) {
+        return {parent.begin(), parent.end()};
+    }
+
+    return replace_subtree(parent, point, subtree);
+}
+
+Program point_mutation(ProgramView parent, std::mt19937& rng, const Options& options) {
+    check_options(options);
+
+    const auto point = random_point(parent, rng);
+
+    Program out{parent.begin(), parent.end()};
+    auto& instruction = out[point];
+
+    switch (arity(instruction.op)) {
+        case 0: {
+            const auto size = instruction.size;
+            instruction = random_terminal(rng, options);
+            instruction.size = size;
+            break;
+        }
+        case 1: {
+            std::uniform_int_distribution<std::size_t> pick{0, std::size(unary) - 1};
+            instruction.op = unary[pick(rng)];
+            break;
+        }
+        default: {
+            std::uniform_int_distribution<std::size_t> pick{0, std::size(binary) - 1};
+            instruction.op = binary[pick(rng)];
+            break;
+        }
+    }
+
+    return out;
+}
+
+void Interpreter::evaluate(ProgramView program,
+                           const std::vector<double>& inputs,
+                           std::size_t cases,
+                           std::vector<double>& outputs) {
+    // --
+    // Error check our inputs
+    if (cases == 0) { throw std::invalid_argument("cases must be greater than 0"); }
+    if (inputs.size() % cases != 0) { throw std::invalid_argument("inputs must hold a whole number of variables"); }
+
+    const auto variables = inputs.size() / cases;
+    for (const auto& instruction : program) {
+        if (instruction.op == Opcode::Variable && instruction.variable >= variables) {
+            throw std::out_of_range("program reads a variable that is out of range");
+        }
+    }
+
+    m_stack.resize(stack_depth(program) * lanes);
+    outputs.resize(cases);
+
+    for (std::size_t base = 0; base < cases; base += lanes) {
+        const auto count = std::min(lanes, cases - base);
+        double* stack = m_stack.data();
+        std::size_t sp = 0;
+
+        for (const auto& instruction : program) {
+            double* a = stack + (sp - arity(instruction.op)) * lanes;
+            const double* b = a + lanes;
+
+            switch (instruction.op) {
+                case Opcode::Constant:
+                    for (std::size_t l = 0; l < lanes; ++l) a[l] = instruction.constant;
+                    break;
+                case Opcode::Variable: {
+                    const double* source = inputs.data() + instruction.variable * cases + base;
+                    if (count == lanes) {
+                        for (std::size_t l = 0; l < lanes; ++l) a[l] = source[l];
+                    } else {
+                        // The last block may be partial, the spare lanes are computed but never written out
+                        std::fill(std::copy(source, source + count, a), a + lanes, 0.0);
+                    }
+                    break;
+                }
+                case Opcode::Add:
+                    for (std::size_t l = 0; l < lanes; ++l) a[l] += b[l];
+                    break;
+                case Opcode::Subtract:
+                    for (std::size_t l = 0; l < lanes; ++l) a[l] -= b[l];
+                    break;
+                case Opcode::Multiply:
+                    for (std::size_t l = 0; l < lanes; ++l) a[l] *= b[l];
+                    break;
+                case Opcode::Divide:
+                    for (std::size_t l = 0; l < lanes; ++l) a[l] = (b[l] == 0.0) ? 1.0 : a[l] / b[l];
+                    break;
+                case Opcode::Negate:
+                    for (std::size_t l = 0; l < lanes; ++l) a[l] = -a[l];
+                    break;
+                case Opcode::Sin:
+                    for (std::size_t l = 0; l < lanes; ++l) a[l] = std::sin(a[l]);
+                    break;
+                case Opcode::Cos:
+                    for (std::size_t l = 0; l < lanes; ++l) a[l] = std::cos(a[l]);
+                    break;
+            }
+
+            sp = sp - arity(instruction.op) + 1;
+        }
+
+        std::copy(stack, stack + count, outputs.begin() + base);
+    }
+}
+
+} // namespace moxie::Genetics::Programs
@@ -0,0 +1,126 @@
+#include "Genetics/Racing.hpp"
+
+#include "Genetics/Selection.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+
+namespace moxie::Genetics::Racing {
+
+Race::Race(const Sampler& sample, std::size_t population_size, std::size_t n, const Options& options)
+        : m_mean(population_size, 0.0),
+          m_m2(population_size, 0.0),
+          m_samples(population_size, 0),
+          m_state(population_size, State::Racing) {
+    // --
+    // Error check our inputs
+    if (n > population_size) {
+        throw std::invalid_argument("n cannot be larger than population size");
+    } else if (options.min_samples == 0 || options.slice == 0) {
+        throw std::invalid_argument("race must take at least 1 sample per round");
+    } else if (options.min_samples > options.max_samples) {
+        throw std::invalid_argument("min samples cannot be greater than max samples");
+    }
+
+    // Every candidate gets the minimum number of replications before any are decided
+    for (std::size_t i = 0; i < population_size; ++i) {
+        while (m_samples[i] < options.min_samples) add_sample(i, sample(i, m_samples[i]));
+    }
+    decide(n, options.z);
+
+    // --
+    // Race the undecided candidates, one slice of replications at a time
+    while (true) {
+        bool sampled = false;
+        for (std::size_t i = 0; i < population_size; ++i) {
+            if (m_state[i] != State::Racing) continue;
+
+            const auto target = std::min(m_samples[i] + options.slice, options.max_samples);
+            while (m_samples[i] < target) { add_sample(i, sample(i, m_samples[i])); sampled = true; }
+        }
+
+        if (!sampled) break;
+        decide(n, options.z);
+    }
+}
+
+std::size_t Race::total_samples() const {
+    return std::accumulate(m_samples.begin(), m_samples.end(), std::size_t{0});
+}
+
+void Race::add_sample(std::size_t i, double value) {
+    // Welford's online update of the mean and sum of squared deviations
+    const auto delta = value - m_mean[i];
+    m_mean[i] += delta / static_cast<double>(++m_samples[i]);
+    m_m2[i]   += delta * (value - m_mean[i]);
+}
+
+double Race::standard_error(std::size_t i) const {
+    if (m_samples[i] < 2) return std::numeric_limits<double>::infinity();
+
+    const auto count = static_cast<double>(m_samples[i]);
+    return std::sqrt(m_m2[i] / (count - 1.0) / count);
+}
+
+void Race::decide(std::size_t n, double z) {
+    const auto size = m_mean.size();
+
+    // --
+    // The confidence bounds of every candidate, sorted so they can be counted by binary search
+    std::vector<double> lower(size), upper(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        const auto margin = z * standard_error(i);
+        lower[i] = m_mean[i] - margin;
+        upper[i] = m_mean[i] + margin;
+    }
+
+    auto sorted_lower = lower, sorted_upper = upper;
+    std::sort(sorted_lower.begin(), sorted_lower.end());
+    std::sort(sorted_upper.begin(), sorted_upper.end());
+
+    auto count_greater = [](const std::vector<double>& sorted, double value) {
+        return static_cast<std::size_t>(sorted.end() - std::upper_bound(sorted.begin(), sorted.end(), value));
+    };
+
+    for (std::size_t i = 0; i < size; ++i) {
+        if (m_state[i] != State::Racing) continue;
+
+        // Candidates that are confidently better than i (a candidate is never confidently better than itself)
+        const auto better = count_greater(sorted_lower, upper[i]);
+
+        // Candidates that could be better than i (excluding i itself)
+        const auto rivals = count_greater(sorted_upper, lower[i]) - (upper[i] > lower[i] ? 1 : 0);
+
+        if (better >= n) {
+            m_state[i] = State::Eliminated;
+        } else if (rivals < n) {
+            m_state[i] = State::Accepted;
+        }
+    }
+}
+
+
+std::vector<std::size_t> truncate(const Race::Sampler& sample,
+                                  const std::size_t& population_size,
+                                  const std::size_t& n,
+                                  const Options& options) {
+    const auto race = Race{sample, population_size, n, options};
+    return Selection::truncate(race.fitness(), n);
+}
+
+std::vector<std::size_t> tournament_selection(const Race::Sampler& sample,
+                                              const std::size_t& population_size,
+                                              const std::size_t& n,
+                                              const std::size_t& k,
+                                              double p,
+                                              std::mt19937& rng,
+                                              const Options& options) {
+    const auto race = Race{sample, population_size, n, options};
+    return Selection::tournament_selection(race.fitness(), n, k, p, rng);
+}
+
+} // namespace moxie::Genetics::Racing
@@ -0,0 +1,262 @@
+#include "Genetics/Scaling.hpp"
+
+#include "Util/Parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+
+namespace moxie::Genetics::Scaling {
+
+namespace {
+
+//! The summary statistics gathered by a single fused pass over the fitness values
+struct Summary {
+    double      sum   = 0.0;
+    double      mean  = 0.0;    //! The running mean, and sum of squared deviations from it (Welford)
+    double      m2    = 0.0;
+    double      min   = std::numeric_limits<double>::infinity();
+    double      max   = -std::numeric_limits<double>::infinity();
+    std::size_t count = 0;
+
+    [[nodiscard]] double stddev() const {
+        return count == 0 ? 0.0 : std::sqrt(m2 / static_cast<double>(count));
+    }
+
+    //! Combines the statistics of two disjoint ranges (Chan et al.), without cancellation between large sums
+    void merge(const Summary& other) {
+        if (other.count == 0) return;
+        if (count == 0) { *this = other; return; }
+
+        const auto n_a = static_cast<double>(count), n_b = static_cast<double>(other.count);
+        const auto n = n_a + n_b;
+        const auto delta = other.mean - mean;
+
+        mean  += delta * n_b / n;
+        m2    += other.m2 + delta * delta * n_a * n_b / n;
+        sum   += other.sum;
+        count += other.count;
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+    }
+};
+
+std::size_t resolve(std::size_t threads, std::size_t n) {
+    return threads == 0 ? Util::thread_count(n, parallel_threshold) : threads;
+}
+
+/**
+ *  Computes the sum, mean, squared deviation, min and max of [first, last) in one pass. Independent
+ *  accumulators are kept for each of the lanes, which breaks the dependency chains so the loop can be
+ *  vectorized without relaxing floating point semantics. Every lane has seen the same number of values,
+ *  so the Welford update shares a single reciprocal per block.
+ */
+Summary summarize(const double* first, const double* last) {
+    static constexpr std::size_t lanes = 4;
+
+    double sum[lanes] = {}, mean[lanes] = {}, m2[lanes] = {};
+    double min[lanes], max[lanes];
+    std::fill(min, min + lanes, std::numeric_limits<double>::infinity());
+    std::fill(max, max + lanes, -std::numeric_limits<double>::infinity());
+
+    const auto n = static_cast<std::size_t>(last - first);
+    const auto blocked = n - n % lanes;
+
+    for (std::size_t i = 0; i < blocked; i += lanes) {
+        const auto scale = 1.0 / static_cast<double>(i / lanes + 1);
+        for (std::size_t l = 0; l < lanes; ++l) {
+            const auto x = first[i + l];
+            const auto delta = x - mean[l];
+            sum[l] += x;
+            mean[l] += delta * scale;
+            m2[l] += delta * (x - mean[l]);
+            min[l] = x < min[l] ? x : min[l];
+            max[l] = x > max[l] ? x : max[l];
+        }
+    }
+
+    Summary out{};
+    for (std::size_t l = 0; l < lanes && blocked > 0; ++l) {
+        Summary lane{};
+        lane.sum = sum[l]; lane.mean = mean[l]; lane.m2 = m2[l];
+        lane.min = min[l]; lane.max = max[l];
+        lane.count = blocked / lanes;
+        out.merge(lane);
+    }
+    for (std::size_t i = blocked; i < n; ++i) {
+        Summary single{};
+        single.sum = first[i]; single.mean = first[i];
+        single.min = first[i]; single.max = first[i];
+        single.count = 1;
+        out.merge(single);
+    }
+
+    return out;
+}
+
+Summary summarize(const std::vector<double>& values, std::size_t threads, const std::vector<std::size_t>& cpus) {
+    std::vector<Summary> partial(threads);
+    Util::parallel_for(values.size(), threads, cpus, [&](std::size_t t, std::size_t begin, std::size_t end) {
+        partial[t] = summarize(values.data() + begin, values.data() + end);
+    });
+
+    Summary out{};
+    for (const auto& summary : partial) out.merge(summary);
+
+    return out;
+}
+
+//! Applies fn to every value in-place
+template <typename Fn>
+void transform(std::vector<double>& values, std::size_t threads, const std::vector<std::size_t>& cpus, Fn fn) {
+    Util::parallel_for(values.size(), threads, cpus, [&](std::size_t, std::size_t begin, std::size_t end) {
+        auto* data = values.data();
+        for (std::size_t i = begin; i < end; ++i) data[i] = fn(data[i]);
+    });
+}
+
+}
+
+void objective(std::vector<double>& values, std::size_t threads, const std::vector<std::size_t>& cpus) {
+    threads = resolve(threads, values.size());
+
+    const auto max_value = summarize(values, threads, cpus).max;
+    transform(values, threads, cpus, [=](double value) { return max_value - value; });
+}
+
+void normalize(std::vector<double>& fitness, std::size_t threads, const std::vector<std::size_t>& cpus) {
+    threads = resolve(threads, fitness.size());
+
+    const auto scale = 1.0 / summarize(fitness, threads, cpus).sum;
+    transform(fitness, threads, cpus, [=](double value) { return value * scale; });
+}
+
+void linear(std::vector<double>& fitness, double c, std::size_t threads, const std::vector<std::size_t>& cpus) {
+    if (c < 1) { throw std::invalid_argument("scaling factor cannot be less than 1"); }
+
+    threads = resolve(threads, fitness.size());
+    const auto summary = summarize(fitness, threads, cpus);
+    const auto avg = summary.mean;
+
+    // A uniform population is left as-is
+    if (summary.max <= avg) return;
+
+    double a, b;
+    if (summary.min > (c * avg - summary.max) / (c - 1.0)) {
+        // Stretch so the best member has c times the average fitness
+        const auto delta = summary.max - avg;
+        a = (c - 1.0) * avg / delta;
+        b = avg * (summary.max - c * avg) / delta;
+    } else {
+        // Stretch as far as possible, so the worst member has a fitness of 0
+        const auto delta = avg - summary.min;
+        a = avg / delta;
+        b = -summary.min * avg / delta;
+    }
+
+    transform(fitness, threads, cpus, [=](double value) { return a * value + b; });
+}
+
+void sigma_truncation(std::vector<double>& fitness, double c, std::size_t threads, const std::vector<std::size_t>& cpus) {
+    threads = resolve(threads, fitness.size());
+
+    const auto summary = summarize(fitness, threads, cpus);
+    const auto offset = summary.mean - c * summary.stddev();
+
+    transform(fitness, threads, cpus, [=](double value) { return std::max(0.0, value - offset); });
+}
+
+void rank(std::vector<double>& fitness, double pressure, std::size_t threads, const std::vector<std::size_t>& cpus) {
+    if (pressure < 1 || pressure > 2) { throw std::invalid_argument("selective pressure must be between 1 and 2"); }
+
+    const auto n = fitness.size();
+    if (n == 0) return;
+    threads = resolve(threads, n);
+
+    // --
+    // Order the indices from worst to best: each thread sorts its own range, and the sorted ranges are merged
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+
+    auto worse = [&](std::size_t i, std::size_t j) {
+        return fitness[i] < fitness[j] || (fitness[i] == fitness[j] && i < j);
+    };
+
+    std::vector<std::size_t> bounds(threads + 1, n);
+    Util::parallel_for(n, threads, cpus, [&](std::size_t t, std::size_t begin, std::size_t end) {
+        bounds[t] = begin;
+        std::sort(order.begin() + static_cast<std::ptrdiff_t>(begin), order.begin() + static_cast<std::ptrdiff_t>(end), worse);
+    });
+
+    for (std::size_t width = 1; width < threads; width *= 2) {
+        for (std::size_t t = 0; t + width < threads; t += 2 * width) {
+            const auto last = std::min(t + 2 * width, threads);
+            std::inplace_merge(order.begin() + static_cast<std::ptrdiff_t>(bounds[t]),
+                               order.begin() + static_cast<std::ptrdiff_t>(bounds[t + width]),
+                               order.begin() + static_cast<std::ptrdiff_t>(bounds[last]),
+                               worse);
+        }
+    }
+
+    // --
+    // Assign the fitness linearly by rank
+    if (n == 1) {
+        fitness[0] = 1.0;
+        return;
+    }
+
+    const auto base = 2.0 - pressure;
+    const auto step = 2.0 * (pressure - 1.0) / static_cast<double>(n - 1);
+
+    Util::parallel_for(n, threads, cpus, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t r = begin; r < end; ++r) fitness[order[r]] = base + step * static_cast<double>(r);
+    });
+}
+
+void boltzmann(std::vector<double>& fitness, double temperature, std::size_t threads, const std::vector<std::size_t>& cpus) {
+    if (temperature <= 0) { throw std::invalid_argument("temperature must be greater than 0"); }
+
+    const auto n = fitness.size();
+    if (n == 0) return;
+    threads = resolve(threads, n);
+
+    // Shift by the maximum so the exponentials cannot overflow (the shift cancels in the normalization)
+    const auto max_value = summarize(fitness, threads, cpus).max;
+    const auto inverse_temperature = 1.0 / temperature;
+
+    // Fuse the exponentiation with the sum needed to normalize
+    std::vector<double> partial(threads, 0.0);
+    Util::parallel_for(n, threads, cpus, [&](std::size_t t, std::size_t begin, std::size_t end) {
+        auto* data = fitness.data();
+        double sum = 0.0;
+        for (std::size_t i = begin; i < end; ++i) {
+            data[i] = std::exp((data[i] - max_value) * inverse_temperature);
+            sum += data[i];
+        }
+        partial[t] = sum;
+    });
+
+    const auto scale = static_cast<double>(n) / std::accumulate(partial.begin(), partial.end(), 0.0);
+    transform(fitness, threads, cpus, [=](double value) { return value * scale; });
+}
+
+void windowing(std::vector<double>& fitness, double baseline, std::size_t threads, const std::vector<std::size_t>& cpus) {
+    transform(fitness, resolve(threads, fitness.size()), cpus, [=](double value) { return std::max(0.0, value - baseline); });
+}
+
+
+Window::Window(std::size_t generations) : m_generations(generations) {
+    if (generations == 0) { throw std::invalid_argument("window must span at least 1 generation"); }
+}
+
+double Window::update(const std::vector<double>& fitness) {
+    m_minima.push_back(summarize(fitness, resolve(0, fitness.size()), {}).min);
+    if (m_minima.size() > m_generations) m_minima.pop_front();
+
+    return *std::min_element(m_minima.begin(), m_minima.end());
+}
+
+} // namespace moxie::Genetics::Scaling
@@ -1,14 +1,52 @@
 #include "Genetics/Selection.hpp"
+#include "Genetics/Scaling.hpp"
 
 #include "Util/AliasTable.hpp"
 
 #include <set>
 #include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
 
 
 
 namespace moxie::Genetics::Selection {
 
+namespace {
+
+/**
+ *  Returns the AliasTable that picks the winner of a tournament of size k with probability p (the i'th best member
+ *  wins with probability proportional to p * (1 - p)^i). The tables are cached process-wide, keyed by (k, p).
+ */
+std::shared_ptr<const Util::AliasTable> tournament_table(std::size_t k, double p) {
+    static constexpr std::size_t max_cached_tables = 64;
+
+    static std::mutex mutex;
+    static std::map<std::pair<std::size_t, double>, std::shared_ptr<const Util::AliasTable>> cache;
+
+    const std::lock_guard<std::mutex> lock{mutex};
+
+    const auto key = std::make_pair(k, p);
+    if (const auto it = cache.find(key); it != cache.end()) return it->second;
+
+    // As p approaches 0 the (normalized) distribution approaches a uniform one
+    auto weights = std::vector<double>(k, 1.0);
+    if (p > 0) {
+        weights.front() = p;
+        for (std::size_t i = 1; i < k; ++i) weights[i] = weights[i - 1] * (1 - p);
+    }
+
+    // Callers hold their own reference, so the cache can simply be emptied if it grows too large
+    if (cache.size() >= max_cached_tables) cache.clear();
+
+    return cache.emplace(key, std::make_shared<const Util::AliasTable>(weights)).first->second;
+}
+
+}
+
 std::vector<std::size_t> truncate(const std::vector<double>& fitness,
                                   const std::size_t& n) {
     // --
@@ -28,10 +66,31 @@ std::vector<std::size_t> truncate(const std::vector<double>& fitness,
     return {indices.begin(), indices.begin() + static_cast<std::vector<double>::difference_type>(n)};
 }
 
+std::vector<std::size_t> universal_sampling(const std::size_t& population_size,
+                                            const std::size_t& n,
+                                            std::mt19937& rng) {
+    // --
+    // Error check our inputs
+    if (n > population_size) { throw std::invalid_argument("n cannot be larger than population size"); }
+
+    // Sample the indices uniformly without replacement
+    std::vector<std::size_t> indices(population_size, 0);
+    std::iota(indices.begin(), indices.end(), 0);
+
+    std::vector<std::size_t> out{}; out.reserve(n);
+    std::sample(indices.begin(), indices.end(), std::back_inserter(out), n, rng);
+
+    return out;
+}
+
 std::vector<std::size_t> proportional_selection(const std::vector<double>& fitness,
                                                 const std::size_t& n, std::mt19937& rng) {
-    // Use an AliasTable to perform efficient selection using the cdf.
-    const auto selection = Util::AliasTable{normalize_fitness(fitness)}.sampleDistinct(rng, n);
+    // Use an AliasTable to perform efficient selection using the cdf (the table normalizes the fitness itself,
+    // and each thread rebuilds its own table in-place to avoid reallocating it on every call)
+    thread_local Util::AliasTable aliasTable{};
+    aliasTable.rebuild(fitness);
+
+    const auto selection = aliasTable.sampleDistinct(rng, n);
     return {selection.begin(), selection.end()};
 }
 
@@ -54,7 +113,7 @@ std::vector<std::size_t> tournament_selection(const std::vector<double>& fitness
 
     std::set<std::size_t> selected{};
 
-    std::uniform_int_distribution<std::size_t> indices{0, fitness.size()};
+    std::uniform_int_distribution<std::size_t> indices{0, fitness.size() - 1};
 
     auto cmp = [&](auto i, auto j) {
         if (fitness[i] == fitness[j]) {
@@ -79,13 +138,9 @@ std::vector<std::size_t> tournament_selection(const std::vector<double>& fitness
     };
 
     // --
-    // Create an AliasTable that we can re-use across the tournaments because
-    // the cdf remains constant
-    auto cdf = std::vector<double>{p};
-    const auto p_prime = 1 - p;
-    for (std::size_t i = 1; i < k; ++i) cdf.push_back(cdf.back() * p_prime);
-
-    auto aliasTable = Util::AliasTable(cdf);
+    // Fetch the AliasTable that we can re-use across the tournaments (and calls) because
+    // the cdf remains constant for a given k and p
+    const auto aliasTable = tournament_table(k, p);
 
     // --
     // Repeat tournaments until we have selected enough people
@@ -94,7 +149,7 @@ std::vector<std::size_t> tournament_selection(const std::vector<double>& fitness
         const auto tournament_members = create_tournament();
 
         // Select the winner of the tournament by sampling the AliasTable
-        const auto winner = tournament_members[aliasTable.sample(rng)];
+        const auto winner = tournament_members[aliasTable->sample(rng)];
         selected.insert(winner);
     }
 
@@ -102,26 +157,20 @@ std::vector<std::size_t> tournament_selection(const std::vector<double>& fitness
 }
 
 std::vector<double> objective_value_fitness(const std::vector<double>& values) {
-    // Determine the maximum objective value
-    const auto max_value = std::max(values.begin(), values.end());
-
     // Convert objective value to fitness (relative fitness is measure of distance to max objective value)
-    std::vector<double> out{}; out.reserve(values.size());
-    std::for_each(values.begin(), values.end(), [&](auto value) { out.push_back(*max_value - value); });
+    auto out = values;
+    Scaling::objective(out);
 
     return out;
 }
 
 
 std::vector<double> normalize_fitness(const std::vector<double>& fitness) {
-    // Determine the sum of population fitness
-    const auto sum = std::accumulate(fitness.begin(), fitness.end(), 0.0);
-
-    // Normalize population fitness with respect to this sum
-    std::vector<double> normalized_fitness{}; normalized_fitness.reserve(fitness.size());
-    std::for_each(fitness.begin(), fitness.end(), [&](auto item) { normalized_fitness.push_back(item / sum); });
+    // Normalize population fitness with respect to the sum of population fitness
+    auto out = fitness;
+    Scaling::normalize(out);
 
-    return normalized_fitness;
+    return out;
 }
 
 
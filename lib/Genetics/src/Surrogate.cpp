@@ -0,0 +1,70 @@
+#include "Genetics/Surrogate.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+
+namespace moxie::Genetics::Surrogate {
+
+Screener::Screener(std::size_t dimensions, std::size_t k) : m_k(k), m_index(dimensions) {
+    if (k == 0) { throw std::invalid_argument("k must be greater than 0"); }
+}
+
+void Screener::add(const std::vector<double>& genes, double fitness) {
+    m_index.insert(genes);
+    m_fitness.push_back(fitness);
+}
+
+double Screener::predict(const std::vector<double>& genes) const {
+    if (m_fitness.empty()) { throw std::logic_error("cannot predict fitness from an empty archive"); }
+
+    const auto neighbours = m_index.nearest(genes, m_k);
+
+    // An exact match in the archive is returned as-is
+    if (neighbours.front().second == 0.0) return m_fitness[neighbours.front().first];
+
+    // Otherwise weight each neighbour by its inverse squared distance
+    double weighted = 0.0, total = 0.0;
+    for (const auto& [i, distance] : neighbours) {
+        const auto weight = 1.0 / distance;
+        weighted += weight * m_fitness[i];
+        total    += weight;
+    }
+
+    return weighted / total;
+}
+
+std::vector<std::size_t> Screener::screen(const std::vector<std::vector<double>>& offspring, double fraction) {
+    if (fraction < 0 || fraction > 1) { throw std::invalid_argument("fraction must be between 0 and 1"); }
+
+    std::vector<std::size_t> indices(offspring.size());
+    std::iota(indices.begin(), indices.end(), 0);
+
+    m_statistics.screened += offspring.size();
+
+    // The model is unreliable until the archive has enough neighbours to draw on
+    if (m_fitness.size() < m_k) {
+        m_statistics.evaluated += offspring.size();
+        return indices;
+    }
+
+    std::vector<double> predicted{}; predicted.reserve(offspring.size());
+    for (const auto& genes : offspring) predicted.push_back(predict(genes));
+
+    // Keep the best predicted fraction of the offspring
+    const auto n = std::min(offspring.size(),
+                            static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(offspring.size()))));
+
+    std::partial_sort(indices.begin(),
+                      indices.begin() + static_cast<std::ptrdiff_t>(n),
+                      indices.end(),
+                      [&](auto i, auto j) { return predicted[i] > predicted[j]; });
+    indices.resize(n);
+
+    m_statistics.evaluated += n;
+    return indices;
+}
+
+} // namespace moxie::Genetics::Surrogate
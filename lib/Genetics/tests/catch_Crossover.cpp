@@ -75,3 +75,38 @@ TEST_CASE("uniform_crossover: sanity") {
         REQUIRE(std::equal(sequence_b.begin(), sequence_b.end(), image_of_b.begin()));
     }
 }
+
+TEST_CASE("binary_crossover: works with fixed-size sequences") {
+    const auto sequence_a = make_fixed_sequence<int, 4>([](auto) { return 0; });
+    const auto sequence_b = make_fixed_sequence<int, 4>([](auto) { return 1; });
+
+    SECTION("runtime splice point") {
+        const auto& [child_a, child_b] = Crossover::Splicer::binary_crossover(sequence_a, sequence_b, 1);
+
+        REQUIRE(child_a[0] == sequence_b[0]);
+        REQUIRE(std::all_of(child_a.begin() + 1, child_a.end(), [&](auto e) { return e == sequence_a[0]; }));
+        REQUIRE(child_b[0] == sequence_a[0]);
+        REQUIRE(std::all_of(child_b.begin() + 1, child_b.end(), [&](auto e) { return e == sequence_b[0]; }));
+    }
+
+    SECTION("compile-time splice point") {
+        const auto& [child_a, child_b] = Crossover::Splicer::binary_crossover<3>(sequence_a, sequence_b);
+
+        REQUIRE(std::all_of(child_a.begin(), child_a.begin() + 3, [&](auto e) { return e == sequence_b[0]; }));
+        REQUIRE(child_a[3] == sequence_a[0]);
+        REQUIRE(std::all_of(child_b.begin(), child_b.begin() + 3, [&](auto e) { return e == sequence_a[0]; }));
+        REQUIRE(child_b[3] == sequence_b[0]);
+    }
+}
+
+TEST_CASE("uniform_crossover: works with fixed-size sequences") {
+    const auto sequence_a = make_fixed_sequence<int, 10>([](auto) { return 0; });
+    const auto sequence_b = make_fixed_sequence<int, 10>([](auto) { return 1; });
+
+    Crossover::Splicer splicer{};
+
+    const auto& [image_of_b, image_of_a] = splicer.uniform_crossover(sequence_a, sequence_b, 1.0);
+
+    REQUIRE(image_of_a == sequence_a);
+    REQUIRE(image_of_b == sequence_b);
+}
@@ -0,0 +1,90 @@
+#include <catch2/catch_all.hpp>
+
+#include "Genetics/Diversity.hpp"
+#include "Genetics/Genome.hpp"
+
+using namespace moxie::Genetics;
+
+
+TEST_CASE("distinct: removes exact duplicates") {
+    const auto population = std::vector<Sequence<int>>{
+        {Genome{1}, Genome{2}},
+        {Genome{2}, Genome{1}},
+        {Genome{1}, Genome{2}},
+        {Genome{3}, Genome{3}},
+        {Genome{2}, Genome{1}},
+    };
+
+    REQUIRE(Diversity::distinct(population) == std::vector<std::size_t>{0, 1, 3});
+}
+
+TEST_CASE("distinct: supports a projection onto the genes") {
+    struct Individual { FixedSequence<int, 2> genes; };
+
+    const auto population = std::vector<Individual>{
+        {make_fixed_sequence<int, 2>([](auto i) { return static_cast<int>(i); })},
+        {make_fixed_sequence<int, 2>([](auto i) { return static_cast<int>(i); })},
+    };
+
+    const auto selection = Diversity::distinct(population, [](const auto& member) -> const auto& { return member.genes; });
+    REQUIRE(selection == std::vector<std::size_t>{0});
+}
+
+TEST_CASE("distinct_approx: removes near duplicates") {
+    const auto population = std::vector<Sequence<double>>{
+        {Genome{0.10}, Genome{0.10}},
+        {Genome{0.15}, Genome{0.12}},   // Same cell as the first member
+        {Genome{0.10}, Genome{1.10}},
+        {Genome{-0.1}, Genome{0.10}},
+    };
+
+    REQUIRE(Diversity::distinct_approx(population, 0.5) == std::vector<std::size_t>{0, 2, 3});
+    REQUIRE_THROWS(Diversity::distinct_approx(population, 0.0));
+}
+
+TEST_CASE("gene_variance: sanity") {
+    const auto population = std::vector<Sequence<double>>{
+        {Genome{1.0}, Genome{5.0}},
+        {Genome{3.0}, Genome{5.0}},
+    };
+
+    const auto variance = Diversity::gene_variance(population);
+
+    REQUIRE(variance.size() == 2);
+    REQUIRE(variance[0] == Catch::Approx(1.0));
+    REQUIRE(variance[1] == Catch::Approx(0.0));
+
+    // The only distinct pair is a distance of 2 apart
+    REQUIRE(Diversity::mean_pairwise_distance(variance, population.size()) == Catch::Approx(2.0));
+    REQUIRE(Diversity::mean_pairwise_distance(variance, 1) == 0.0);
+}
+
+TEST_CASE("mean_pairwise_distance: matches a brute force search over distinct pairs") {
+    const auto population = std::vector<Sequence<double>>{
+        {Genome{0.0}, Genome{1.0}},
+        {Genome{3.0}, Genome{-2.0}},
+        {Genome{1.5}, Genome{4.0}},
+        {Genome{-1.0}, Genome{0.5}},
+    };
+
+    double sum = 0.0;
+    std::size_t pairs = 0;
+    for (std::size_t i = 0; i < population.size(); ++i) {
+        for (std::size_t j = i + 1; j < population.size(); ++j, ++pairs) {
+            for (std::size_t d = 0; d < 2; ++d) {
+                const auto delta = population[i][d].value() - population[j][d].value();
+                sum += delta * delta;
+            }
+        }
+    }
+
+    const auto variance = Diversity::gene_variance(population);
+    REQUIRE(Diversity::mean_pairwise_distance(variance, population.size()) == Catch::Approx(std::sqrt(sum / pairs)));
+}
+
+TEST_CASE("adaptive_mutation_rate: sanity") {
+    REQUIRE(Diversity::adaptive_mutation_rate(1.0, 1.0, 0.2) == Catch::Approx(0.2));
+    REQUIRE(Diversity::adaptive_mutation_rate(0.5, 1.0, 0.2) == Catch::Approx(0.4));
+    REQUIRE(Diversity::adaptive_mutation_rate(0.0, 1.0, 0.2, 0.0, 0.8) == Catch::Approx(0.8));
+    REQUIRE_THROWS(Diversity::adaptive_mutation_rate(1.0, 0.0, 0.2));
+}
@@ -29,3 +29,17 @@ TEST_CASE("Genome: verify comparison operators") {
     REQUIRE(foo == foo);
     REQUIRE(foo != bar);
 }
+
+TEST_CASE("FixedSequence: genes are initialized in order and can be mutated together") {
+    auto sequence = make_fixed_sequence<int, 5>([](auto i) { return static_cast<int>(i); });
+
+    for (std::size_t i = 0; i < sequence.size(); ++i) {
+        REQUIRE(sequence[i].value() == static_cast<int>(i));
+    }
+
+    mutate_all(sequence, [](auto foo) { return foo * 2; });
+
+    for (std::size_t i = 0; i < sequence.size(); ++i) {
+        REQUIRE(sequence[i].value() == static_cast<int>(2 * i));
+    }
+}
@@ -0,0 +1,100 @@
+#include <catch2/catch_all.hpp>
+
+#include "Genetics/ChangeSet.hpp"
+#include "Genetics/Crossover.hpp"
+#include "Genetics/Genome.hpp"
+#include "Genetics/Incremental.hpp"
+
+using namespace moxie::Genetics;
+
+
+TEST_CASE("ChangeSet: sanity") {
+    ChangeSet changes{130};
+
+    changes.mark(0);
+    changes.mark(64);
+    changes.mark(129);
+
+    REQUIRE(changes.count() == 3);
+    REQUIRE(changes.test(64));
+    REQUIRE_FALSE(changes.test(63));
+    REQUIRE(changes.indices() == std::vector<std::size_t>{0, 64, 129});
+
+    REQUIRE_THROWS(changes.mark(130));
+
+    changes.clear();
+    REQUIRE(changes.count() == 0);
+}
+
+TEST_CASE("ChangeSet: tracks changes through crossover and mutation") {
+    const auto sequence_a = Sequence<int>(10, Genome{0});
+    const auto sequence_b = Sequence<int>(10, Genome{1});
+
+    Crossover::Splicer splicer{};
+
+    SECTION("uniform crossover with p=1 changes every gene") {
+        ChangeSet changes_a{10}, changes_b{10};
+        const auto& [child_a, child_b] = splicer.uniform_crossover(sequence_a, sequence_b, 1.0, changes_a, changes_b);
+
+        REQUIRE(changes_a.count() == 10);
+        REQUIRE(changes_b.count() == 10);
+    }
+
+    SECTION("uniform crossover with p=0 changes no genes") {
+        ChangeSet changes_a{10}, changes_b{10};
+        const auto& [child_a, child_b] = splicer.uniform_crossover(sequence_a, sequence_b, 0.0, changes_a, changes_b);
+
+        REQUIRE(changes_a.count() == 0);
+        REQUIRE(changes_b.count() == 0);
+    }
+
+    SECTION("mutation marks only the genes whose value changed") {
+        auto child = sequence_a;
+        ChangeSet changes{10};
+
+        std::size_t calls = 0;
+        mutate_all(child, [&](auto value) { return calls++ % 3 == 0 ? value + 1 : value; }, changes);
+
+        REQUIRE(changes.indices() == std::vector<std::size_t>{0, 3, 6, 9});
+    }
+}
+
+TEST_CASE("Incremental: separable objectives are updated from the parent state") {
+    const auto square = [](std::size_t, double value) { return value * value; };
+    const auto fitness = Incremental::Separable{square};
+
+    const auto parent = make_fixed_sequence<double, 100>([](auto i) { return static_cast<double>(i); });
+    const auto parent_state = fitness.evaluate(parent);
+
+    // Change two genes of the child
+    auto child = parent;
+    ChangeSet changes{child.size()};
+    mutate_all(child, [](double value) { return value == 10.0 || value == 50.0 ? -value - 1 : value; }, changes);
+    REQUIRE(changes.count() == 2);
+
+    const auto expected = fitness.evaluate(child);
+    const auto actual   = Incremental::evaluate(fitness, &parent_state, child, changes);
+
+    REQUIRE(actual.fitness == Catch::Approx(expected.fitness));
+    REQUIRE(actual.terms == expected.terms);
+
+    SECTION("a full evaluation is used when there is no parent") {
+        const auto full = Incremental::evaluate(fitness, static_cast<decltype(parent_state)*>(nullptr), child, changes);
+        REQUIRE(full.fitness == Catch::Approx(expected.fitness));
+    }
+
+    SECTION("a state the caller owns is updated in place") {
+        auto state = parent_state;
+        Incremental::update(fitness, state, child, changes);
+
+        REQUIRE(state.fitness == Catch::Approx(expected.fitness));
+        REQUIRE(state.terms == expected.terms);
+    }
+
+    SECTION("a moved-in parent state is reused") {
+        auto state = fitness.evaluate(parent_state, child, changes);
+        state = fitness.evaluate(std::move(state), parent, changes);
+
+        REQUIRE(state.fitness == Catch::Approx(parent_state.fitness));
+    }
+}
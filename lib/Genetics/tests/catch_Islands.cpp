@@ -0,0 +1,107 @@
+#include <catch2/catch_all.hpp>
+
+#include <chrono>
+
+#include "Genetics/Islands.hpp"
+
+using namespace moxie::Genetics;
+
+
+TEST_CASE("Islands: migrants survive encoding") {
+    const auto migrants = std::vector<Islands::Migrant<double>>{
+        {1.0, {0.5, 1.5, 2.5}},
+        {2.0, {3.5, 4.5, 5.5}},
+    };
+
+    const auto decoded = Islands::decode<double>(Islands::encode(migrants));
+
+    REQUIRE(decoded.size() == migrants.size());
+    for (std::size_t i = 0; i < migrants.size(); ++i) {
+        REQUIRE(decoded[i].fitness == migrants[i].fitness);
+        REQUIRE(decoded[i].genes == migrants[i].genes);
+    }
+
+    SECTION("should raise an error for malformed messages") {
+        auto message = Islands::encode(migrants);
+        message.pop_back();
+        REQUIRE_THROWS(Islands::decode<double>(message));
+        REQUIRE_THROWS(Islands::decode<double>({}));
+    }
+
+    SECTION("should raise an error for migrants of differing sizes") {
+        REQUIRE_THROWS(Islands::encode(std::vector<Islands::Migrant<int>>{{1.0, {1}}, {1.0, {1, 2}}}));
+    }
+}
+
+TEST_CASE("Islands: migrants travel around the ring") {
+    const auto islands = std::size_t{4};
+
+    const auto statuses = Islands::Coordinator{islands}.run([](Islands::Island& island) {
+        const auto index = static_cast<int>(island.index());
+        if (!island.emigrate(std::vector<Islands::Migrant<int>>{{static_cast<double>(index), {index, index}}})) {
+            return 2;
+        }
+
+        // Wait (for a bounded time) for the migrant from the previous island
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (std::chrono::steady_clock::now() < deadline) {
+            const auto migrants = island.immigrate<int>(100);
+            if (migrants.empty()) continue;
+
+            const auto expected = static_cast<int>((island.index() + island.count() - 1) % island.count());
+            return migrants.front().genes == std::vector<int>{expected, expected} ? 0 : 3;
+        }
+
+        return 4;
+    });
+
+    REQUIRE(statuses == std::vector<int>(islands, 0));
+}
+
+TEST_CASE("Islands: batches larger than the socket buffer are delivered whole") {
+    // 3 migrants x 30000 doubles is ~720 KB, several times the default socket buffer (wmem_default)
+    static constexpr std::size_t dimensions = 30000;
+
+    const auto statuses = Islands::Coordinator{2}.run([](Islands::Island& island) {
+        const auto index = static_cast<double>(island.index());
+
+        std::vector<Islands::Migrant<double>> batch{};
+        for (std::size_t m = 0; m < 3; ++m) {
+            batch.push_back({index, std::vector<double>(dimensions, index * 10.0 + static_cast<double>(m))});
+        }
+        if (!island.emigrate(batch)) return 2;
+
+        // Keep receiving (which also drains our outbox) until the whole batch from the other island arrives
+        const auto expected = static_cast<double>((island.index() + 1) % island.count());
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (std::chrono::steady_clock::now() < deadline) {
+            const auto migrants = island.immigrate<double>(10);
+            if (migrants.empty()) continue;
+
+            if (migrants.size() != 3) return 3;
+            for (std::size_t m = 0; m < 3; ++m) {
+                const auto value = expected * 10.0 + static_cast<double>(m);
+                if (migrants[m].fitness != expected || migrants[m].genes != std::vector<double>(dimensions, value)) {
+                    return 4;
+                }
+            }
+
+            // Let our own batch finish sending before the island exits
+            while (!island.flush() && std::chrono::steady_clock::now() < deadline) (void)island.receive(10);
+            return 0;
+        }
+
+        return 5;
+    });
+
+    REQUIRE(statuses == std::vector<int>(2, 0));
+}
+
+TEST_CASE("Islands: a worker that throws reports a failure") {
+    const auto statuses = Islands::Coordinator{2}.run([](Islands::Island& island) -> int {
+        if (island.index() == 1) throw std::runtime_error("failed");
+        return 0;
+    });
+
+    REQUIRE(statuses == std::vector<int>{0, 1});
+}
@@ -0,0 +1,99 @@
+#include <catch2/catch_all.hpp>
+
+#include <filesystem>
+#include <numeric>
+#include <random>
+#include <set>
+
+#include "Genetics/MappedPopulation.hpp"
+#include "Genetics/Selection.hpp"
+
+using namespace moxie::Genetics;
+
+namespace {
+
+//! A uniquely named file in the temporary directory, removed when it goes out of scope (even if a test fails)
+class TemporaryFile {
+public:
+    explicit TemporaryFile(const std::string& name) {
+        std::random_device device{};
+        const auto unique = std::to_string(device()) + "_" + std::to_string(device());
+        m_path = std::filesystem::temp_directory_path() / ("moxie_" + name + "_" + unique + ".bin");
+    }
+
+    ~TemporaryFile() {
+        std::error_code error{};
+        std::filesystem::remove(m_path, error);
+    }
+
+    TemporaryFile(const TemporaryFile& other) = delete;
+    TemporaryFile& operator=(const TemporaryFile& other) = delete;
+
+    [[nodiscard]] std::string path() const { return m_path.string(); }
+
+private:
+    std::filesystem::path m_path;
+};
+
+}
+
+
+TEST_CASE("MappedPopulation: evaluate streams over every member") {
+    const TemporaryFile file{"evaluate"};
+    {
+        MappedPopulation<double> population{file.path(), 100, 3};
+
+        for (std::size_t i = 0; i < population.size(); ++i) {
+            std::fill_n(population.row(i), population.dimensions(), static_cast<double>(i));
+        }
+
+        // Use a small chunk size so the population is processed in several chunks
+        population.evaluate([](const double* genes, std::size_t n) { return std::accumulate(genes, genes + n, 0.0); }, 7);
+
+        for (std::size_t i = 0; i < population.size(); ++i) {
+            REQUIRE(population.fitness()[i] == Catch::Approx(3.0 * static_cast<double>(i)));
+        }
+
+        // The index-based selection functions work directly on the in-memory fitness
+        const auto survivors = Selection::truncate(population.fitness(), 2);
+        REQUIRE(std::set<std::size_t>{survivors.begin(), survivors.end()} == std::set<std::size_t>{98, 99});
+    }
+}
+
+TEST_CASE("MappedPopulation: gather and breed write the next generation") {
+    const TemporaryFile file_current{"current"};
+    const TemporaryFile file_next{"next"};
+    {
+        MappedPopulation<int> current{file_current.path(), 10, 4};
+        MappedPopulation<int> next{file_next.path(), 10, 4};
+
+        for (std::size_t i = 0; i < current.size(); ++i) {
+            std::fill_n(current.row(i), current.dimensions(), static_cast<int>(i));
+        }
+
+        const auto first_child = current.gather(next, {9, 8});
+        REQUIRE(first_child == 2);
+        REQUIRE(next.row(0)[0] == 9);
+        REQUIRE(next.row(1)[3] == 8);
+
+        // Swap the first half of each pair of parents
+        auto crossover = [](const int* a, const int* b, int* child_a, int* child_b, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                child_a[i] = i < n / 2 ? b[i] : a[i];
+                child_b[i] = i < n / 2 ? a[i] : b[i];
+            }
+        };
+
+        const auto end = current.breed(next, {1, 2, 3, 4}, crossover, first_child, 2);
+        REQUIRE(end == 6);
+        REQUIRE(std::vector<int>{next.row(2), next.row(2) + 4} == std::vector<int>{2, 2, 1, 1});
+        REQUIRE(std::vector<int>{next.row(3), next.row(3) + 4} == std::vector<int>{1, 1, 2, 2});
+        REQUIRE(std::vector<int>{next.row(5), next.row(5) + 4} == std::vector<int>{3, 3, 4, 4});
+
+        SECTION("should raise an error for invalid selections") {
+            REQUIRE_THROWS(current.breed(next, {1, 2, 3}, crossover));
+            REQUIRE_THROWS(current.breed(next, {1, 20}, crossover));
+            REQUIRE_THROWS(current.gather(next, std::vector<std::size_t>(11, 0)));
+        }
+    }
+}
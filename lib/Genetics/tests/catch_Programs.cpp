@@ -0,0 +1,133 @@
+#include <catch2/catch_all.hpp>
+
+#include <cmath>
+#include <random>
+
+#include "Genetics/Programs.hpp"
+#include "Genetics/Selection.hpp"
+
+using namespace moxie::Genetics;
+using Programs::Instruction;
+using Programs::Opcode;
+
+
+namespace {
+
+// x0 * x0 + 1
+const auto square_plus_one = Programs::Program{
+    Instruction{Opcode::Variable, 0, 1},
+    Instruction{Opcode::Variable, 0, 1},
+    Instruction{Opcode::Multiply, 0, 3},
+    Instruction{Opcode::Constant, 0, 1, 1.0},
+    Instruction{Opcode::Add,      0, 5},
+};
+
+} // namespace
+
+
+TEST_CASE("Programs: the interpreter evaluates a batch of fitness cases") {
+    // 13 cases covers a full block of lanes and a partial one
+    std::vector<double> inputs(13);
+    for (std::size_t i = 0; i < inputs.size(); ++i) inputs[i] = static_cast<double>(i) - 6.0;
+
+    Programs::Interpreter interpreter;
+    std::vector<double> outputs;
+    interpreter.evaluate(square_plus_one, inputs, inputs.size(), outputs);
+
+    REQUIRE(outputs.size() == inputs.size());
+    for (std::size_t i = 0; i < inputs.size(); ++i) REQUIRE(outputs[i] == Catch::Approx(inputs[i] * inputs[i] + 1.0));
+
+    REQUIRE_THROWS_AS(interpreter.evaluate(square_plus_one, inputs, 0, outputs), std::invalid_argument);
+    REQUIRE_THROWS_AS(interpreter.evaluate(square_plus_one, {}, 1, outputs), std::out_of_range);
+}
+
+TEST_CASE("Programs: stack depth validates the program") {
+    REQUIRE(Programs::stack_depth(square_plus_one) == 2);
+
+    auto underflow = square_plus_one;
+    underflow.erase(underflow.begin());
+    REQUIRE_THROWS_AS(Programs::stack_depth(underflow), std::invalid_argument);
+
+    auto bad_size = square_plus_one;
+    bad_size[2].size = 2;
+    REQUIRE_THROWS_AS(Programs::stack_depth(bad_size), std::invalid_argument);
+}
+
+TEST_CASE("Programs: replacing a subtree keeps the size annotations consistent") {
+    const auto replacement = Programs::Program{
+        Instruction{Opcode::Constant, 0, 1, 2.0},
+        Instruction{Opcode::Negate,   0, 2},
+    };
+
+    // Replace x0 * x0 with -2
+    const auto child = Programs::replace_subtree(square_plus_one, 2, replacement);
+    REQUIRE(child.size() == 4);
+    REQUIRE(child.back().size == 4);
+    REQUIRE_NOTHROW(Programs::stack_depth(child));
+
+    Programs::Interpreter interpreter;
+    std::vector<double> outputs;
+    interpreter.evaluate(child, {3.0}, 1, outputs);
+    REQUIRE(outputs.front() == Catch::Approx(-1.0));
+}
+
+TEST_CASE("Programs: variation operators produce valid programs") {
+    std::mt19937 rng{11};
+
+    auto options = Programs::Options{};
+    options.variables  = 2;
+    options.max_length = 64;
+
+    Programs::Arena arena;
+    for (std::size_t i = 0; i < 20; ++i) arena.add(Programs::random_program(rng, options));
+    REQUIRE(arena.size() == 20);
+
+    for (std::size_t i = 0; i + 1 < arena.size(); ++i) {
+        const auto [a, b] = Programs::subtree_crossover(arena[i], arena[i + 1], rng, options);
+        REQUIRE_NOTHROW(Programs::stack_depth(a));
+        REQUIRE_NOTHROW(Programs::stack_depth(b));
+        REQUIRE(a.size() + b.size() == arena[i].size + arena[i + 1].size);
+
+        REQUIRE_NOTHROW(Programs::stack_depth(Programs::subtree_mutation(arena[i], rng, options)));
+        REQUIRE_NOTHROW(Programs::stack_depth(Programs::point_mutation(arena[i], rng, options)));
+    }
+
+    SECTION("should raise an error for more variables than an instruction can index") {
+        options.variables = 65537;
+        REQUIRE_THROWS_AS(Programs::random_program(rng, options), std::invalid_argument);
+        REQUIRE_THROWS_AS(Programs::subtree_mutation(arena[0], rng, options), std::invalid_argument);
+        REQUIRE_THROWS_AS(Programs::point_mutation(arena[0], rng, options), std::invalid_argument);
+
+        options.variables = 65536;
+        REQUIRE_NOTHROW(Programs::random_program(rng, options));
+    }
+}
+
+TEST_CASE("Programs: populations are selected through a fitness vector") {
+    std::mt19937 rng{5};
+
+    auto options = Programs::Options{};
+    options.max_depth = 3;
+
+    Programs::Arena arena;
+    arena.add(square_plus_one);
+    for (std::size_t i = 0; i < 30; ++i) arena.add(Programs::random_program(rng, options));
+
+    std::vector<double> inputs, targets;
+    for (double x = -2.0; x <= 2.0; x += 0.25) {
+        inputs.push_back(x);
+        targets.push_back(x * x + 1.0);
+    }
+
+    Programs::Interpreter interpreter;
+    std::vector<double> outputs, fitness;
+    for (std::size_t i = 0; i < arena.size(); ++i) {
+        interpreter.evaluate(arena[i], inputs, inputs.size(), outputs);
+
+        double error = 0.0;
+        for (std::size_t c = 0; c < outputs.size(); ++c) error += std::abs(outputs[c] - targets[c]);
+        fitness.push_back(-error);
+    }
+
+    REQUIRE(Selection::truncate(fitness, 1) == std::vector<std::size_t>{0});
+}
@@ -0,0 +1,57 @@
+#include <catch2/catch_all.hpp>
+
+#include <set>
+
+#include "Genetics/Racing.hpp"
+
+using namespace moxie::Genetics;
+
+namespace {
+
+//! A noisy fitness function where the i'th candidate has a true fitness of i
+Racing::Race::Sampler noisy_sampler(std::mt19937& rng) {
+    return [&rng](std::size_t candidate, std::size_t) {
+        std::uniform_real_distribution<double> noise{-0.5, 0.5};
+        return static_cast<double>(candidate) + noise(rng);
+    };
+}
+
+}
+
+
+TEST_CASE("Race: eliminates losing candidates early") {
+    std::mt19937 rng{1234};
+
+    const auto options = Racing::Options{3, 30, 1, 1.96};
+    const auto race = Racing::Race{noisy_sampler(rng), 20, 5, options};
+
+    // The race should spend far less than the full budget
+    REQUIRE(race.total_samples() < 20 * options.max_samples / 2);
+
+    // The worst candidates are clearly worse than the best, so they should be eliminated after the minimum
+    REQUIRE(race.eliminated(0));
+    REQUIRE(race.samples()[0] == options.min_samples);
+    REQUIRE(race.accepted(19));
+}
+
+TEST_CASE("Race: truncate selects the truly best candidates") {
+    std::mt19937 rng{4321};
+
+    const auto selected = Racing::truncate(noisy_sampler(rng), 20, 5);
+    REQUIRE(std::set<std::size_t>{selected.begin(), selected.end()} == std::set<std::size_t>{15, 16, 17, 18, 19});
+}
+
+TEST_CASE("Race: tournament selection returns n distinct members") {
+    std::mt19937 rng{99};
+
+    const auto selected = Racing::tournament_selection(noisy_sampler(rng), 20, 5, 4, 0.8, rng);
+    REQUIRE(std::set<std::size_t>{selected.begin(), selected.end()}.size() == 5);
+}
+
+TEST_CASE("Race: rejects invalid options") {
+    std::mt19937 rng{1};
+
+    REQUIRE_THROWS(Racing::Race{noisy_sampler(rng), 5, 10});
+    REQUIRE_THROWS(Racing::Race{noisy_sampler(rng), 5, 2, Racing::Options{0, 30, 1, 1.96}});
+    REQUIRE_THROWS(Racing::Race{noisy_sampler(rng), 5, 2, Racing::Options{10, 5, 1, 1.96}});
+}
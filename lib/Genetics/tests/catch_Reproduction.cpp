@@ -0,0 +1,80 @@
+#include <catch2/catch_all.hpp>
+
+#include <numeric>
+
+#include "Genetics/Genome.hpp"
+#include "Genetics/Reproduction.hpp"
+
+using namespace moxie::Genetics;
+
+namespace {
+
+using Individual = Sequence<int>;
+
+std::vector<Individual> make_population(std::size_t size) {
+    std::vector<Individual> out{};
+    for (std::size_t i = 0; i < size; ++i) out.emplace_back(8, Genome{static_cast<int>(i)});
+
+    return out;
+}
+
+std::pair<Individual, Individual> breed(Crossover::Splicer& splicer, std::mt19937& rng,
+                                        const Individual& parent_a, const Individual& parent_b) {
+    auto children = splicer.uniform_crossover(parent_a, parent_b, 0.5);
+
+    std::uniform_int_distribution<int> noise{0, 1000};
+    mutate_all(children.first, [&](int value) { return value + noise(rng); });
+
+    return children;
+}
+
+}
+
+
+TEST_CASE("Reproduction: children are written into their preassigned slots") {
+    const auto population = make_population(4);
+    auto next = make_population(6);
+
+    Reproduction::breed(population, {0, 1, 2, 3}, next, 2, 42,
+        [](Crossover::Splicer&, std::mt19937&, const Individual& a, const Individual& b) {
+            return Crossover::Splicer::binary_crossover(a, b, 0);
+        });
+
+    // The slots before the first child are left untouched
+    REQUIRE(next[0] == Individual(8, Genome{0}));
+    REQUIRE(next[1] == Individual(8, Genome{1}));
+
+    // A splice point of 0 yields exact copies of the parents
+    REQUIRE(next[2] == population[0]);
+    REQUIRE(next[3] == population[1]);
+    REQUIRE(next[4] == population[2]);
+    REQUIRE(next[5] == population[3]);
+
+    SECTION("should raise an error for invalid inputs") {
+        auto copy = [](Crossover::Splicer&, std::mt19937&, const Individual& a, const Individual& b) { return std::make_pair(a, b); };
+        REQUIRE_THROWS(Reproduction::breed(population, {0, 1, 2}, next, 0, 42, copy));
+        REQUIRE_THROWS(Reproduction::breed(population, {0, 1}, next, 5, 42, copy));
+        REQUIRE_THROWS(Reproduction::breed(population, {0, 10}, next, 0, 42, copy));
+    }
+}
+
+TEST_CASE("Reproduction: results are deterministic regardless of thread count") {
+    const auto population = make_population(2000);
+
+    std::vector<std::size_t> parents(population.size());
+    std::iota(parents.begin(), parents.end(), 0);
+
+    auto serial = make_population(population.size());
+    auto parallel = make_population(population.size());
+
+    Reproduction::breed(population, parents, serial, 0, 1234, breed, 1);
+    Reproduction::breed(population, parents, parallel, 0, 1234, breed, 4);
+
+    REQUIRE(serial == parallel);
+
+    // A different seed should breed different children
+    auto reseeded = make_population(population.size());
+    Reproduction::breed(population, parents, reseeded, 0, 4321, breed, 4);
+
+    REQUIRE(serial != reseeded);
+}
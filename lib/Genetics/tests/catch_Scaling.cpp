@@ -0,0 +1,133 @@
+#include <catch2/catch_all.hpp>
+
+#include <cmath>
+#include <numeric>
+
+#include "Genetics/Scaling.hpp"
+#include "Genetics/Selection.hpp"
+
+using namespace moxie::Genetics;
+
+namespace {
+
+double mean(const std::vector<double>& values) {
+    return std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+}
+
+}
+
+
+TEST_CASE("objective: converts objective values relative to the maximum") {
+    auto values = std::vector<double>{3.0, 1.0, 4.0, 1.5};
+    Scaling::objective(values);
+
+    REQUIRE(values == std::vector<double>{1.0, 3.0, 0.0, 2.5});
+
+    // The allocating version should agree with the in-place one
+    REQUIRE(Selection::objective_value_fitness({3.0, 1.0, 4.0, 1.5}) == values);
+}
+
+TEST_CASE("normalize: fitness sums to 1") {
+    auto fitness = std::vector<double>{1.0, 2.0, 3.0, 4.0};
+    Scaling::normalize(fitness);
+
+    REQUIRE(std::accumulate(fitness.begin(), fitness.end(), 0.0) == Catch::Approx(1.0));
+    REQUIRE(fitness[3] == Catch::Approx(0.4));
+}
+
+TEST_CASE("linear: preserves the average and scales the best member") {
+    auto fitness = std::vector<double>{4.0, 5.0, 6.0};
+    Scaling::linear(fitness, 1.5);
+
+    REQUIRE(mean(fitness) == Catch::Approx(5.0));
+    REQUIRE(fitness[2] == Catch::Approx(7.5));
+
+    SECTION("fitness never becomes negative") {
+        auto skewed = std::vector<double>{0.0, 0.0, 0.0, 10.0};
+        Scaling::linear(skewed, 2.0);
+
+        REQUIRE(std::all_of(skewed.begin(), skewed.end(), [](auto value) { return value >= 0.0; }));
+        REQUIRE(mean(skewed) == Catch::Approx(2.5));
+    }
+}
+
+TEST_CASE("sigma_truncation: sanity") {
+    auto fitness = std::vector<double>{1.0, 3.0};
+    Scaling::sigma_truncation(fitness, 1.0);
+
+    // mean = 2, sigma = 1, so the values are offset by 1
+    REQUIRE(fitness[0] == Catch::Approx(0.0));
+    REQUIRE(fitness[1] == Catch::Approx(2.0));
+}
+
+TEST_CASE("sigma_truncation: is unaffected by a large common offset") {
+    // The spread of 1e8 +- 1 cancels catastrophically if it is computed as E[x^2] - E[x]^2
+    std::vector<double> fitness(1001);
+    for (std::size_t i = 0; i < fitness.size(); ++i) fitness[i] = 1e8 + (i % 2 == 0 ? -1.0 : 1.0);
+
+    const auto n = static_cast<double>(fitness.size());
+    const auto offset_mean  = 1e8 - 1.0 / n;
+    const auto offset_sigma = std::sqrt(1.0 - 1.0 / (n * n));
+
+    for (const auto threads : {std::size_t{1}, std::size_t{4}}) {
+        auto scaled = fitness;
+        Scaling::sigma_truncation(scaled, 1.0, threads);
+
+        for (std::size_t i = 0; i < scaled.size(); ++i) {
+            const auto expected = fitness[i] - (offset_mean - offset_sigma);
+            REQUIRE(scaled[i] == Catch::Approx(expected).margin(1e-6));
+        }
+    }
+}
+
+TEST_CASE("rank: assigns fitness linearly by rank") {
+    auto fitness = std::vector<double>{10.0, -5.0, 3.0};
+    Scaling::rank(fitness, 2.0);
+
+    REQUIRE(fitness == std::vector<double>{2.0, 0.0, 1.0});
+
+    REQUIRE_THROWS(Scaling::rank(fitness, 3.0));
+}
+
+TEST_CASE("boltzmann: average fitness is 1 and order is preserved") {
+    auto fitness = std::vector<double>{1.0, 1000.0, 2.0};
+    Scaling::boltzmann(fitness, 10.0);
+
+    REQUIRE(mean(fitness) == Catch::Approx(1.0));
+    REQUIRE(fitness[1] > fitness[2]);
+    REQUIRE(fitness[2] > fitness[0]);
+}
+
+TEST_CASE("windowing: subtracts the minimum over the window") {
+    Scaling::Window window{2};
+
+    REQUIRE(window.update({5.0, 6.0}) == 5.0);
+    REQUIRE(window.update({7.0, 8.0}) == 5.0);
+    REQUIRE(window.update({9.0, 8.0}) == 7.0);
+
+    auto fitness = std::vector<double>{9.0, 8.0};
+    Scaling::windowing(fitness, 7.0);
+    REQUIRE(fitness == std::vector<double>{2.0, 1.0});
+}
+
+TEST_CASE("scaling: parallel results match serial results") {
+    std::mt19937 rng{42};
+    std::uniform_real_distribution<double> distrib{-100.0, 100.0};
+
+    std::vector<double> fitness(10'007);
+    std::generate(fitness.begin(), fitness.end(), [&]() { return distrib(rng); });
+
+    auto serial = fitness, parallel = fitness;
+
+    SECTION("rank") {
+        Scaling::rank(serial, 1.5, 1);
+        Scaling::rank(parallel, 1.5, 4);
+        REQUIRE(serial == parallel);
+    }
+
+    SECTION("sigma_truncation") {
+        Scaling::sigma_truncation(serial, 2.0, 1);
+        Scaling::sigma_truncation(parallel, 2.0, 4);
+        for (std::size_t i = 0; i < fitness.size(); ++i) REQUIRE(serial[i] == Catch::Approx(parallel[i]));
+    }
+}
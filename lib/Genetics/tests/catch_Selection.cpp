@@ -117,3 +117,91 @@ TEST_CASE("tournament_selection: sanity") {
         REQUIRE_THROWS(Selection::tournament_selection(fitness, 100, 6, 0.8, rng));
     }
 }
+
+
+TEST_CASE("view: references the selected members without copying") {
+    const auto population = std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    const auto fitness = std::vector<double>{0.5, 0.1, 1.0, 3.0, 0.001, 0.9, 10.0, 0.7, 0.75, 10.0};
+
+    const auto selection = Selection::view(population, Selection::truncate(fitness, 4));
+
+    REQUIRE(selection.size() == 4);
+    for (const auto& member : selection) {
+        // Each element should refer directly into the population
+        const auto* address = &member.get();
+        CHECK((address >= population.data() && address < population.data() + population.size()));
+    }
+
+    REQUIRE_THROWS(Selection::view(population, {20}));
+}
+
+TEST_CASE("compact: moves the selected members to the front of the population") {
+    auto population = std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    SECTION("survivors are contiguous and in selection order") {
+        const auto selection = std::vector<std::size_t>{9, 0, 4, 1};
+        REQUIRE(Selection::compact(population, selection) == selection.size());
+
+        REQUIRE(std::vector<int>{population.begin(), population.begin() + 4} == std::vector<int>{10, 1, 5, 2});
+
+        // The population should still be a permutation of the original
+        REQUIRE(std::set<int>{population.begin(), population.end()}.size() == 10);
+    }
+
+    SECTION("should raise an error for invalid selections") {
+        REQUIRE_THROWS(Selection::compact(population, {0, 0}));
+        REQUIRE_THROWS(Selection::compact(population, {20}));
+    }
+
+    SECTION("should leave the population untouched when the selection is invalid") {
+        const auto original = population;
+        REQUIRE_THROWS_AS(Selection::compact(population, {9, 4, 9}), std::invalid_argument);
+        REQUIRE_THROWS_AS(Selection::compact(population, {9, 4, 20}), std::out_of_range);
+        REQUIRE(population == original);
+    }
+}
+
+TEST_CASE("universal_sampling: sampling indices") {
+    auto rng = get_random_number_generator();
+
+    const auto sample = Selection::universal_sampling(10, 4, rng);
+
+    REQUIRE(std::set<std::size_t>{sample.begin(), sample.end()}.size() == 4);
+    REQUIRE(std::all_of(sample.begin(), sample.end(), [](auto i) { return i < 10; }));
+    REQUIRE_THROWS(Selection::universal_sampling(10, 20, rng));
+}
+
+TEST_CASE("tournament_selection: tables are reused across calls") {
+    auto rng = get_random_number_generator();
+
+    const auto fitness = std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+
+    // Repeated calls with the same (k, p) share a cached table, and p=0 degenerates to a uniform choice
+    for (const auto p : {0.8, 0.8, 0.0, 1.0}) {
+        const auto sample = Selection::tournament_selection(fitness, 3, 4, p, rng);
+        REQUIRE(std::set<std::size_t>{sample.begin(), sample.end()}.size() == 3);
+    }
+
+    SECTION("p=1 always selects the best member of a full tournament") {
+        const auto sample = Selection::tournament_selection(fitness, 1, fitness.size(), 1.0, rng);
+        REQUIRE(sample == std::vector<std::size_t>{7});
+    }
+}
+
+TEST_CASE("proportional_selection: handles degenerate fitness") {
+    auto rng = get_random_number_generator();
+
+    SECTION("zero fitness is treated as uniform") {
+        const auto sample = Selection::proportional_selection(std::vector<double>(10, 0.0), 4, rng);
+        REQUIRE(std::set<std::size_t>{sample.begin(), sample.end()}.size() == 4);
+    }
+
+    SECTION("negative fitness is rejected") {
+        REQUIRE_THROWS(Selection::proportional_selection({1.0, -1.0, 2.0}, 1, rng));
+    }
+
+    SECTION("selecting every member returns every index") {
+        const auto sample = Selection::proportional_selection({1.0, 2.0, 3.0}, 3, rng);
+        REQUIRE(sample == std::vector<std::size_t>{0, 1, 2});
+    }
+}
@@ -0,0 +1,64 @@
+#include <catch2/catch_all.hpp>
+
+#include <random>
+
+#include "Genetics/Genome.hpp"
+#include "Genetics/Surrogate.hpp"
+
+using namespace moxie::Genetics;
+
+
+TEST_CASE("KDTree: nearest neighbours match a brute force search") {
+    std::mt19937 rng{7};
+    std::uniform_real_distribution<double> distrib{-1.0, 1.0};
+
+    moxie::Util::KDTree tree{3};
+    for (std::size_t i = 0; i < 500; ++i) tree.insert({distrib(rng), distrib(rng), distrib(rng)});
+
+    for (std::size_t q = 0; q < 20; ++q) {
+        const auto query = std::vector<double>{distrib(rng), distrib(rng), distrib(rng)};
+
+        std::vector<double> distances(tree.size());
+        for (std::size_t i = 0; i < tree.size(); ++i) {
+            const auto* p = tree.point(i);
+            distances[i] = (p[0] - query[0]) * (p[0] - query[0]) + (p[1] - query[1]) * (p[1] - query[1]) + (p[2] - query[2]) * (p[2] - query[2]);
+        }
+        std::sort(distances.begin(), distances.end());
+
+        const auto nearest = tree.nearest(query, 5);
+        REQUIRE(nearest.size() == 5);
+        for (std::size_t i = 0; i < nearest.size(); ++i) REQUIRE(nearest[i].second == Catch::Approx(distances[i]));
+    }
+}
+
+TEST_CASE("Screener: predicts and screens offspring") {
+    Surrogate::Screener screener{1, 2};
+
+    // The archive models f(x) = x
+    for (const auto x : {0.0, 1.0, 2.0, 3.0, 4.0}) screener.add({x}, x);
+
+    REQUIRE(screener.predict({2.0}) == Catch::Approx(2.0));
+    REQUIRE(screener.predict({2.5}) == Catch::Approx(2.5));
+
+    const auto offspring = std::vector<Sequence<double>>{
+        {Genome{0.1}}, {Genome{3.9}}, {Genome{1.2}}, {Genome{3.1}},
+    };
+
+    const auto selected = screener.screen(offspring, 0.5, [](const auto& member) -> const auto& { return member; });
+    REQUIRE(selected == std::vector<std::size_t>{1, 3});
+
+    REQUIRE(screener.statistics().screened == 4);
+    REQUIRE(screener.statistics().evaluated == 2);
+    REQUIRE(screener.statistics().savings() == Catch::Approx(0.5));
+}
+
+TEST_CASE("Screener: passes everything through until the archive is large enough") {
+    Surrogate::Screener screener{2, 3};
+    screener.add({0.0, 0.0}, 1.0);
+
+    const auto selected = screener.screen(std::vector<std::vector<double>>{{1.0, 1.0}, {2.0, 2.0}}, 0.1);
+    REQUIRE(selected.size() == 2);
+    REQUIRE(screener.statistics().savings() == 0.0);
+
+    REQUIRE_THROWS(screener.screen(std::vector<std::vector<double>>{}, 2.0));
+}
@@ -15,13 +15,40 @@ namespace moxie::Util {
 
 /**
  *  @short  An alias table can be used to efficiently sample vales from a cdf (cumulative distribution function)
- *          This object takes O(n logn) time to build, and constant O(1) time to sample.
+ *          This object takes O(n) time to build, and constant O(1) time to sample.
+ *
+ *          The weights given to the table need not be normalized (if they are all zero, every element is equally
+ *          likely). The table may be rebuilt in-place, reusing its memory, and large tables are built in parallel.
  *
  *  @cite   https://en.wikipedia.org/wiki/Alias_method
+ *  @cite   Hübschle-Schneider & Sanders, Parallel Weighted Random Sampling (the "sweeping" construction)
  */
 class AliasTable {
 public:
-    explicit AliasTable(const std::vector<double>& probabilities);
+    //! Tables of at least this many entries are built in parallel (when threads is 0, i.e. automatic)
+    static constexpr std::size_t parallel_threshold = std::size_t{1} << 20;
+
+    AliasTable() = default;
+    explicit AliasTable(const std::vector<double>& probabilities,
+                        std::size_t threads = 0,
+                        const std::vector<std::size_t>& cpus = {});
+
+    /**
+     *  @short  Rebuild the table for a new distribution, reusing the memory of the previous one. When cpus is
+     *          given, the construction threads are pinned to them (see parallel_for).
+     */
+    void rebuild(const double* probabilities,
+                 std::size_t size,
+                 std::size_t threads = 0,
+                 const std::vector<std::size_t>& cpus = {});
+    void rebuild(const std::vector<double>& probabilities,
+                 std::size_t threads = 0,
+                 const std::vector<std::size_t>& cpus = {}) {
+        rebuild(probabilities.data(), probabilities.size(), threads, cpus);
+    }
+
+    //! @short  The number of elements in the collection
+    [[nodiscard]] std::size_t size() const { return m_table.size(); }
 
     //! @short  Sample an element from the collection
     [[nodiscard]] std::size_t sample(std::mt19937& rng) const;
@@ -30,8 +57,18 @@ public:
     [[nodiscard]] std::set<std::size_t> sampleDistinct(std::mt19937& rng, size_t n) const;
 
 private:
-    std::vector<std::size_t> m_alias;
+    //! The threshold and alias of each entry are interleaved, so a sample touches a single cache line
+    struct Entry {
+        double      threshold;
+        std::size_t alias;
+    };
+
+    std::vector<Entry> m_table;
+
+    // Scratch space for construction, kept so rebuilding the table doesn't allocate
     std::vector<double>      m_weights;
+    std::vector<std::size_t> m_light, m_heavy;
+    std::vector<double>      m_deficit, m_surplus;
 };
 
 } // namespace moxie::Util
@@ -0,0 +1,65 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  A k-d tree for nearest neighbour queries over points in R^d.
+ */
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+namespace moxie::Util {
+
+/**
+ *  @short  A k-d tree that supports incremental insertion and k-nearest-neighbour queries.
+ *
+ *          Points are inserted by descending the existing tree, and the tree is rebuilt (balanced around
+ *          the median of each axis) whenever it has doubled in size since it was last built, so insertion
+ *          is amortized O(log n) and queries stay close to O(log n).
+ *
+ *  @cite   https://en.wikipedia.org/wiki/K-d_tree
+ */
+class KDTree {
+public:
+    explicit KDTree(std::size_t dimensions);
+
+    [[nodiscard]] std::size_t dimensions() const { return m_dimensions; }
+    [[nodiscard]] std::size_t size()       const { return m_nodes.size(); }
+
+    //! @short  Access the coordinates of the i'th inserted point.
+    [[nodiscard]] const double* point(std::size_t i) const { return m_points.data() + i * m_dimensions; }
+
+    //! @short  Insert a point, returning its index (points are indexed in insertion order).
+    std::size_t insert(const std::vector<double>& point);
+
+    /**
+     *  @short  Returns the (up to) k nearest points to the query, as pairs of (index, squared distance)
+     *          sorted from nearest to furthest.
+     */
+    [[nodiscard]] std::vector<std::pair<std::size_t, double>> nearest(const std::vector<double>& query,
+                                                                      std::size_t k) const;
+
+private:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    //! Nodes are stored in insertion order, so node i holds point i
+    struct Node {
+        std::size_t axis  = 0;
+        std::size_t left  = npos;
+        std::size_t right = npos;
+    };
+
+    void rebuild();
+    std::size_t build(std::vector<std::size_t>& indices, std::size_t begin, std::size_t end, std::size_t depth);
+
+    std::size_t         m_dimensions;
+    std::vector<double> m_points;
+    std::vector<Node>   m_nodes;
+    std::size_t         m_root       = npos;
+    std::size_t         m_built_size = 0;
+};
+
+} // namespace moxie::Util
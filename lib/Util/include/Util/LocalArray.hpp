@@ -0,0 +1,134 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  Anonymous memory placed on the NUMA nodes of the threads that use it (POSIX).
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "Util/Parallel.hpp"
+
+
+namespace moxie::Util {
+
+//! @short  The page size used to back an allocation.
+enum class Pages {
+    Normal,
+    Huge,       //! Ask the OS for transparent huge pages (fewer TLB misses when sweeping large matrices)
+};
+
+/**
+ *  @short  An anonymous, page-aligned memory mapping. Mapping memory doesn't touch it, so each page is only
+ *          allocated (on the NUMA node of the faulting thread, under the default Linux policy) once it is
+ *          first written. Huge page mappings are aligned to (and padded to a multiple of) the huge page size.
+ */
+class LocalBuffer {
+public:
+    LocalBuffer() = default;
+    LocalBuffer(std::size_t size, Pages pages);
+    ~LocalBuffer();
+
+    LocalBuffer(const LocalBuffer& other) = delete;
+    LocalBuffer& operator=(const LocalBuffer& other) = delete;
+
+    LocalBuffer(LocalBuffer&& other) noexcept;
+    LocalBuffer& operator=(LocalBuffer&& other) noexcept;
+
+    [[nodiscard]] void*       data()       { return m_data; }
+    [[nodiscard]] const void* data() const { return m_data; }
+    [[nodiscard]] std::size_t size() const { return m_size; }
+
+private:
+    void release() noexcept;
+
+    void*       m_data   = nullptr;
+    std::size_t m_size   = 0;
+    std::size_t m_mapped = 0;     //! The length actually mapped (rounded up to whole huge pages)
+};
+
+/**
+ *  @short  A fixed-size array whose pages are first touched by the threads that own them, so that each
+ *          thread's slice lives on its own NUMA node.
+ *
+ *  The array is split into rows of row_size elements, and rows are partitioned exactly as parallel_for
+ *  partitions [0, rows). Processing the array with parallel_for(rows, threads, cpus, ...) afterwards keeps
+ *  every access node-local.
+ */
+template <typename T>
+class LocalArray {
+    static_assert(std::is_trivially_copyable_v<T>, "LocalArray elements are initialized by zero-filling");
+
+public:
+    LocalArray() = default;
+
+    /**
+     *  @throws std::length_error if rows * row_size elements don't fit in the address space
+     */
+    LocalArray(std::size_t rows,
+               std::size_t row_size,
+               std::size_t threads,
+               const std::vector<std::size_t>& cpus = {},
+               Pages pages = Pages::Normal);
+
+    [[nodiscard]] T*       data()       { return static_cast<T*>(m_buffer.data()); }
+    [[nodiscard]] const T* data() const { return static_cast<const T*>(m_buffer.data()); }
+
+    [[nodiscard]] std::size_t size()     const { return m_rows * m_row_size; }
+    [[nodiscard]] std::size_t rows()     const { return m_rows; }
+    [[nodiscard]] std::size_t row_size() const { return m_row_size; }
+
+    [[nodiscard]] T*       row(std::size_t i)       { return data() + i * m_row_size; }
+    [[nodiscard]] const T* row(std::size_t i) const { return data() + i * m_row_size; }
+
+    [[nodiscard]] T&       operator[](std::size_t i)       { return data()[i]; }
+    [[nodiscard]] const T& operator[](std::size_t i) const { return data()[i]; }
+
+    [[nodiscard]] T* begin() { return data(); }
+    [[nodiscard]] T* end()   { return data() + size(); }
+
+    [[nodiscard]] const T* begin() const { return data(); }
+    [[nodiscard]] const T* end()   const { return data() + size(); }
+
+private:
+    [[nodiscard]] static std::size_t bytes(std::size_t rows, std::size_t row_size);
+
+    LocalBuffer m_buffer;
+    std::size_t m_rows     = 0;
+    std::size_t m_row_size = 0;
+};
+
+
+// --
+// Implementations
+
+template <typename T>
+std::size_t LocalArray<T>::bytes(std::size_t rows, std::size_t row_size) {
+    const auto max_elements = std::numeric_limits<std::size_t>::max() / sizeof(T);
+    if (row_size != 0 && rows > max_elements / row_size) {
+        throw std::length_error("local array is too large");
+    }
+
+    return rows * row_size * sizeof(T);
+}
+
+template <typename T>
+LocalArray<T>::LocalArray(std::size_t rows,
+                          std::size_t row_size,
+                          std::size_t threads,
+                          const std::vector<std::size_t>& cpus,
+                          Pages pages)
+        : m_buffer(bytes(rows, row_size), pages), m_rows(rows), m_row_size(row_size) {
+    // The owner of each slice writes it first, which is what places its pages
+    parallel_for(rows, threads, cpus, [this](std::size_t, std::size_t begin, std::size_t end) {
+        if (begin == end) return;
+        std::memset(static_cast<void*>(row(begin)), 0, (end - begin) * m_row_size * sizeof(T));
+    });
+}
+
+} // namespace moxie::Util
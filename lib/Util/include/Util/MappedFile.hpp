@@ -0,0 +1,60 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  A read/write memory-mapped file (POSIX).
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+
+namespace moxie::Util {
+
+/**
+ *  @short  Maps a file of a fixed size into memory for reading and writing. The file is created (or resized)
+ *          on construction, and the mapping is released on destruction. Pages are loaded by the OS on demand,
+ *          so the file may be much larger than the available memory.
+ */
+class MappedFile {
+public:
+    //! @short  Hints to the OS about how a range of the mapping will be accessed.
+    enum class Advice {
+        Normal,
+        Sequential,     //! Pages will be accessed in order (read-ahead aggressively)
+        Random,         //! Pages will be accessed in no particular order (disable read-ahead)
+        WillNeed,       //! Pages will be accessed soon (prefetch them)
+        DontNeed,       //! Pages will not be accessed soon (they may be evicted)
+    };
+
+    MappedFile(const std::string& path, std::size_t size);
+    ~MappedFile();
+
+    MappedFile(const MappedFile& other) = delete;
+    MappedFile& operator=(const MappedFile& other) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    [[nodiscard]] void*       data()       { return m_data; }
+    [[nodiscard]] const void* data() const { return m_data; }
+    [[nodiscard]] std::size_t size() const { return m_size; }
+
+    //! @short  Advise the OS about the access pattern of the given byte range (rounded out to whole pages).
+    void advise(Advice advice, std::size_t offset, std::size_t length) const;
+
+    //! @short  Advise the OS about the access pattern of the whole mapping.
+    void advise(Advice advice) const { advise(advice, 0, m_size); }
+
+    //! @short  Flush modified pages back to the file.
+    void sync() const;
+
+private:
+    void release() noexcept;
+
+    int         m_fd   = -1;
+    void*       m_data = nullptr;
+    std::size_t m_size = 0;
+};
+
+} // namespace moxie::Util
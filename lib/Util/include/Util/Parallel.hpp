@@ -0,0 +1,47 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  Simple data-parallel helpers.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+
+namespace moxie::Util {
+
+/**
+ *  @short  Returns the number of threads to use for a workload of n elements: 1 when n is below the
+ *          threshold, otherwise the hardware concurrency (capped at n).
+ */
+[[nodiscard]] std::size_t thread_count(std::size_t n, std::size_t threshold);
+
+/**
+ *  @short  Partitions [0, n) into (up to) the given number of contiguous ranges, and calls
+ *          fn(thread, begin, end) for each range on its own thread. The calling thread processes the
+ *          first range, and the first exception thrown by any range is rethrown once all have finished.
+ *
+ *  @note   The partitioning only depends on n and threads, so range i always covers the same elements.
+ */
+void parallel_for(std::size_t n,
+                  std::size_t threads,
+                  const std::function<void(std::size_t thread, std::size_t begin, std::size_t end)>& fn);
+
+/**
+ *  @short  As above, but range t runs on a thread pinned to cpus[t % cpus.size()] (see Topology::schedule).
+ *          The calling thread's own affinity is restored once its range has finished.
+ *
+ *  @note   Since range t always covers the same elements, memory first touched by range t (e.g. a LocalArray)
+ *          is placed on the NUMA node of cpus[t], and later passes over it stay node-local. Pinning is only
+ *          supported on Linux; elsewhere cpus is ignored.
+ *
+ *  @throws std::invalid_argument if a range can't be pinned to its CPU (e.g. one outside the affinity mask)
+ */
+void parallel_for(std::size_t n,
+                  std::size_t threads,
+                  const std::vector<std::size_t>& cpus,
+                  const std::function<void(std::size_t thread, std::size_t begin, std::size_t end)>& fn);
+
+} // namespace moxie::Util
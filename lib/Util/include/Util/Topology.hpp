@@ -0,0 +1,70 @@
+/**
+ *  @date   2026-10-18
+ *
+ *  CPU and NUMA topology detection (Linux sysfs), and thread pinning.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+namespace moxie::Util {
+
+//! @short  A logical CPU, and where it sits in the machine.
+struct Cpu {
+    std::size_t id     = 0;     //! The logical CPU number used by the OS
+    std::size_t core   = 0;     //! The physical core (unique within a socket)
+    std::size_t socket = 0;     //! The physical package
+    std::size_t node   = 0;     //! The NUMA node whose memory is local to this CPU
+};
+
+/**
+ *  @short  The online CPUs the process may run on, grouped by NUMA node. Machines (or sandboxes) without sysfs
+ *          are treated as a single node holding the allowed (or hardware_concurrency) CPUs.
+ */
+class Topology {
+public:
+    /**
+     *  @short  Detect the topology of this machine from the given sysfs root, keeping only the CPUs in the
+     *          process' affinity mask (so taskset, numactl and cgroup cpusets are respected).
+     */
+    [[nodiscard]] static Topology detect(const std::string& root = "/sys/devices/system");
+
+    //! @short  As above, but keeping only the given CPUs (or every online CPU when allowed is empty).
+    [[nodiscard]] static Topology detect(const std::string& root, const std::vector<std::size_t>& allowed);
+
+    [[nodiscard]] const std::vector<Cpu>& cpus() const { return m_cpus; }
+
+    //! @short  Returns the number of NUMA nodes with at least one online CPU.
+    [[nodiscard]] std::size_t nodes() const;
+
+    /**
+     *  @short  Returns the CPUs to pin the given number of threads to, spreading them over the nodes first,
+     *          then over physical cores, and only then over hyper-threaded siblings. Threads wrap around when
+     *          there are more threads than CPUs, and an empty (default constructed) topology returns no CPUs.
+     */
+    [[nodiscard]] std::vector<std::size_t> schedule(std::size_t threads) const;
+
+private:
+    std::vector<Cpu> m_cpus;
+};
+
+/**
+ *  @short  Parses a sysfs CPU list such as "0-3,8,10-11".
+ *
+ *  @throws std::invalid_argument if the list is malformed
+ */
+[[nodiscard]] std::vector<std::size_t> parse_cpu_list(const std::string& list);
+
+//! @short  Returns the CPUs in the calling process' affinity mask (empty if it can't be queried).
+[[nodiscard]] std::vector<std::size_t> allowed_cpus();
+
+/**
+ *  @short  Pins the calling thread to the given CPU, returning false if the OS refused (e.g. the CPU is not in
+ *          the process' allowed set). Pinning is a no-op that returns false on non-Linux platforms.
+ */
+[[nodiscard]] bool pin_this_thread(std::size_t cpu);
+
+} // namespace moxie::Util
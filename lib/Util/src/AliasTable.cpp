@@ -1,67 +1,179 @@
 #include "Util/AliasTable.hpp"
 
+#include "Util/Parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
 
 namespace moxie::Util {
 
-AliasTable::AliasTable(const std::vector<double>& probabilities)
-        : m_alias(probabilities.size(), 0),
-          m_weights(probabilities.size(), 0.0) {
+namespace {
+
+/**
+ *  Computes out[i] = value(0) + ... + value(i) for i in [0, n) in parallel: each range sums its values,
+ *  the range totals are scanned, and then each range scans its values from its offset.
+ */
+template <typename Value>
+void inclusive_scan(std::size_t n,
+                    std::size_t threads,
+                    const std::vector<std::size_t>& cpus,
+                    std::vector<double>& out,
+                    Value value) {
+    out.resize(n);
+
+    std::vector<double> totals(threads + 1, 0.0);
+    parallel_for(n, threads, cpus, [&](std::size_t t, std::size_t begin, std::size_t end) {
+        double sum = 0.0;
+        for (std::size_t i = begin; i < end; ++i) sum += value(i);
+        totals[t + 1] = sum;
+    });
+
+    std::partial_sum(totals.begin(), totals.end(), totals.begin());
+
+    parallel_for(n, threads, cpus, [&](std::size_t t, std::size_t begin, std::size_t end) {
+        double sum = totals[t];
+        for (std::size_t i = begin; i < end; ++i) out[i] = (sum += value(i));
+    });
+}
+
+}
 
-    const auto k = probabilities.size();
-    const auto ratio = 1.0 / static_cast<double>(k);
+AliasTable::AliasTable(const std::vector<double>& probabilities,
+                       std::size_t threads,
+                       const std::vector<std::size_t>& cpus) {
+    rebuild(probabilities, threads, cpus);
+}
+
+void AliasTable::rebuild(const double* probabilities,
+                         std::size_t size,
+                         std::size_t threads,
+                         const std::vector<std::size_t>& cpus) {
+    m_table.resize(size);
+    if (size == 0) return;
+
+    if (threads == 0) threads = thread_count(size, parallel_threshold);
 
     // --
-    // We begin by sorting the entries into 2 bins
-    std::vector<size_t> smaller, larger;
-    for (std::size_t i = 0; i < k; ++i) {
-        m_weights[i] = static_cast<double>(k) * probabilities[i];
-
-        if (m_weights[i] < 1.0) {
-            smaller.push_back(i);
-        } else {
-            larger.push_back(i);
+    // Normalize the weights so they average 1, and split them into light (< 1) and heavy (>= 1) entries,
+    // preserving their order. Every range counts its entries, so it knows where to write them.
+    std::vector<double> partial(threads, 0.0);
+    std::vector<char>   invalid(threads, false);
+    parallel_for(size, threads, cpus, [&](std::size_t t, std::size_t begin, std::size_t end) {
+        double sum = 0.0;
+        for (std::size_t i = begin; i < end; ++i) {
+            if (!(probabilities[i] >= 0.0) || !std::isfinite(probabilities[i])) invalid[t] = true;
+            sum += probabilities[i];
         }
+        partial[t] = sum;
+    });
+
+    const auto total = std::accumulate(partial.begin(), partial.end(), 0.0);
+    if (std::find(invalid.begin(), invalid.end(), true) != invalid.end()) {
+        throw std::invalid_argument("probabilities must be finite and non-negative");
     }
 
-    // --
-    // Now we want to interleave smaller and larger elements
-    while (!smaller.empty() && !larger.empty()) {
-        const auto small = smaller.back(); smaller.pop_back();
-        const auto large = larger.back(); larger.pop_back();
+    // If every probability is zero, every element is treated as equally likely
+    const auto uniform = !(total > 0.0);
+    const auto scale = uniform ? 0.0 : static_cast<double>(size) / total;
+    m_weights.resize(size);
+
+    std::vector<std::size_t> light_offset(threads + 1, 0), heavy_offset(threads + 1, 0);
+    parallel_for(size, threads, cpus, [&](std::size_t t, std::size_t begin, std::size_t end) {
+        std::size_t lights = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            m_weights[i] = uniform ? 1.0 : probabilities[i] * scale;
+            lights += m_weights[i] < 1.0 ? 1 : 0;
+        }
+        light_offset[t + 1] = lights;
+        heavy_offset[t + 1] = (end - begin) - lights;
+    });
 
-        // Place the larger item at the smaller item's index
-        m_alias[small] = large;
+    std::partial_sum(light_offset.begin(), light_offset.end(), light_offset.begin());
+    std::partial_sum(heavy_offset.begin(), heavy_offset.end(), heavy_offset.begin());
 
-        // Offset the remaining weight contribution of the larger item with the weight of the element it displaced
-        m_weights[large] = m_weights[large] - (1.0 - m_weights[small]);
+    m_light.resize(light_offset.back());
+    m_heavy.resize(heavy_offset.back());
 
-        if (m_weights[large] < 1.0) {
-            smaller.push_back(large);
-        } else {
-            larger.push_back(large);
+    parallel_for(size, threads, cpus, [&](std::size_t t, std::size_t begin, std::size_t end) {
+        auto light = light_offset[t], heavy = heavy_offset[t];
+        for (std::size_t i = begin; i < end; ++i) {
+            if (m_weights[i] < 1.0) m_light[light++] = i; else m_heavy[heavy++] = i;
         }
+    });
+
+    // Without both light and heavy entries (up to rounding, the distribution is uniform) nothing needs an alias
+    if (m_light.empty() || m_heavy.empty()) {
+        parallel_for(size, threads, cpus, [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) m_table[i] = Entry{1.0, i};
+        });
+        return;
     }
+
+    // --
+    // The sweeping construction pairs the lights, in order, with the heavies, in order. The deficit[i] of the
+    // lights up to i and the surplus[j] of the heavies up to j determine every pairing in closed form, so
+    // each range of entries can be resolved independently.
+    inclusive_scan(m_light.size(), threads, cpus, m_deficit, [&](std::size_t i) { return 1.0 - m_weights[m_light[i]]; });
+    inclusive_scan(m_heavy.size(), threads, cpus, m_surplus, [&](std::size_t j) { return m_weights[m_heavy[j]] - 1.0; });
+
+    const auto last_heavy = m_heavy.size() - 1;
+
+    // Each light is aliased to the first heavy whose surplus covers the deficit of the lights before it
+    parallel_for(m_light.size(), threads, cpus, [&](std::size_t, std::size_t begin, std::size_t end) {
+        const auto before = begin == 0 ? 0.0 : m_deficit[begin - 1];
+        auto j = static_cast<std::size_t>(std::lower_bound(m_surplus.begin(), m_surplus.end(), before) - m_surplus.begin());
+
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto covered = i == 0 ? 0.0 : m_deficit[i - 1];
+            while (j < last_heavy && m_surplus[j] < covered) ++j;
+
+            const auto index = m_light[i];
+            m_table[index] = Entry{m_weights[index], m_heavy[std::min(j, last_heavy)]};
+        }
+    });
+
+    // Each heavy becomes light once the deficit of the lights exceeds its surplus, and is then aliased to the next heavy
+    parallel_for(m_heavy.size(), threads, cpus, [&](std::size_t, std::size_t begin, std::size_t end) {
+        auto i = static_cast<std::size_t>(std::upper_bound(m_deficit.begin(), m_deficit.end(), m_surplus[begin]) - m_deficit.begin());
+
+        for (std::size_t j = begin; j < end; ++j) {
+            while (i < m_deficit.size() && m_deficit[i] <= m_surplus[j]) ++i;
+
+            const auto index = m_heavy[j];
+            if (j == last_heavy || i == m_deficit.size()) {
+                m_table[index] = Entry{1.0, index};
+            } else {
+                m_table[index] = Entry{1.0 + m_surplus[j] - m_deficit[i], m_heavy[j + 1]};
+            }
+        }
+    });
 }
 
-inline std::size_t AliasTable::sample(std::mt19937& rng) const {
+std::size_t AliasTable::sample(std::mt19937& rng) const {
     std::uniform_real_distribution<double>      random_weight{0.0, 1.0};
-    std::uniform_int_distribution<std::size_t>  random_index{0, m_alias.size() - 1};
+    std::uniform_int_distribution<std::size_t>  random_index{0, m_table.size() - 1};
 
     const auto index = random_index(rng);
-    if (random_weight(rng) < m_weights[index]) {
+    const auto& entry = m_table[index];
+    if (random_weight(rng) < entry.threshold) {
         return index;
     } else {
-        return m_alias[index];
+        return entry.alias;
     }
 }
 
 std::set<std::size_t> AliasTable::sampleDistinct(std::mt19937& rng, std::size_t n) const {
-    if (n > m_alias.size()) {
+    if (n > m_table.size()) {
         throw std::invalid_argument("n is larger than number of possible elements");
     } else if (n == 0) {
         return {};
-    } else if (n == m_alias.size()) {
-        return {m_alias.begin(), m_alias.end()};
+    } else if (n == m_table.size()) {
+        std::set<std::size_t> all{};
+        for (std::size_t i = 0; i < n; ++i) all.insert(all.end(), i);
+        return all;
     }
 
     std::set<std::size_t> taken{};
@@ -0,0 +1,119 @@
+#include "Util/KDTree.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+
+
+namespace moxie::Util {
+
+KDTree::KDTree(std::size_t dimensions) : m_dimensions(dimensions) {
+    if (dimensions == 0) { throw std::invalid_argument("dimensions must be greater than 0"); }
+}
+
+std::size_t KDTree::insert(const std::vector<double>& point) {
+    if (point.size() != m_dimensions) {
+        throw std::invalid_argument("point does not match the dimensions of the tree");
+    }
+
+    const auto index = m_nodes.size();
+    m_points.insert(m_points.end(), point.begin(), point.end());
+    m_nodes.emplace_back();
+
+    // Rebalance once the tree has doubled in size, otherwise descend to a leaf and attach the point there
+    if (m_nodes.size() >= 2 * std::max<std::size_t>(m_built_size, 8)) {
+        rebuild();
+        return index;
+    }
+
+    if (m_root == npos) {
+        m_root = index;
+        return index;
+    }
+
+    auto current = m_root;
+    while (true) {
+        auto& node = m_nodes[current];
+        auto& next = point[node.axis] < this->point(current)[node.axis] ? node.left : node.right;
+        if (next == npos) {
+            next = index;
+            m_nodes[index].axis = (node.axis + 1) % m_dimensions;
+            return index;
+        }
+        current = next;
+    }
+}
+
+void KDTree::rebuild() {
+    std::vector<std::size_t> indices(m_nodes.size());
+    std::iota(indices.begin(), indices.end(), 0);
+
+    m_root = build(indices, 0, indices.size(), 0);
+    m_built_size = m_nodes.size();
+}
+
+std::size_t KDTree::build(std::vector<std::size_t>& indices, std::size_t begin, std::size_t end, std::size_t depth) {
+    if (begin == end) return npos;
+
+    // Split around the median of this axis
+    const auto axis = depth % m_dimensions;
+    const auto middle = begin + (end - begin) / 2;
+
+    std::nth_element(indices.begin() + static_cast<std::ptrdiff_t>(begin),
+                     indices.begin() + static_cast<std::ptrdiff_t>(middle),
+                     indices.begin() + static_cast<std::ptrdiff_t>(end),
+                     [&](auto i, auto j) { return point(i)[axis] < point(j)[axis]; });
+
+    const auto index = indices[middle];
+    const auto left  = build(indices, begin, middle, depth + 1);
+    const auto right = build(indices, middle + 1, end, depth + 1);
+
+    m_nodes[index] = Node{axis, left, right};
+    return index;
+}
+
+std::vector<std::pair<std::size_t, double>> KDTree::nearest(const std::vector<double>& query, std::size_t k) const {
+    if (query.size() != m_dimensions) {
+        throw std::invalid_argument("query does not match the dimensions of the tree");
+    }
+
+    // A max-heap on distance holds the best k candidates found so far
+    auto further = [](const auto& a, const auto& b) { return a.second < b.second; };
+    std::priority_queue<std::pair<std::size_t, double>, std::vector<std::pair<std::size_t, double>>, decltype(further)> best(further);
+
+    if (k == 0) return {};
+
+    // --
+    // Depth-first search, visiting the near side first and pruning subtrees that cannot contain a closer point
+    auto search = [&](auto& self, std::size_t current) -> void {
+        if (current == npos) return;
+
+        const auto* p = point(current);
+        double distance = 0.0;
+        for (std::size_t d = 0; d < m_dimensions; ++d) distance += (query[d] - p[d]) * (query[d] - p[d]);
+
+        if (best.size() < k) {
+            best.emplace(current, distance);
+        } else if (distance < best.top().second) {
+            best.pop();
+            best.emplace(current, distance);
+        }
+
+        const auto& node = m_nodes[current];
+        const auto offset = query[node.axis] - p[node.axis];
+        const auto near = offset < 0 ? node.left : node.right;
+        const auto far  = offset < 0 ? node.right : node.left;
+
+        self(self, near);
+        if (best.size() < k || offset * offset < best.top().second) self(self, far);
+    };
+    search(search, m_root);
+
+    std::vector<std::pair<std::size_t, double>> out(best.size());
+    for (auto i = out.size(); i > 0; --i) { out[i - 1] = best.top(); best.pop(); }
+
+    return out;
+}
+
+} // namespace moxie::Util
@@ -0,0 +1,92 @@
+#include "Util/LocalArray.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <sys/mman.h>
+
+
+namespace moxie::Util {
+
+namespace {
+
+//! Returns the size of a transparent huge page (2 MiB on x86-64 unless the kernel says otherwise)
+std::size_t huge_page_size() {
+    static const auto size = [] {
+        std::size_t bytes = 0;
+        std::ifstream file{"/sys/kernel/mm/transparent_hugepage/hpage_pmd_size"};
+        return (file >> bytes && bytes != 0) ? bytes : std::size_t{2} << 20;
+    }();
+    return size;
+}
+
+}
+
+LocalBuffer::LocalBuffer(std::size_t size, Pages pages) : m_size(size) {
+    // An empty buffer is valid, but mmap rejects zero-length requests
+    if (size == 0) return;
+
+    // Huge pages can only back huge-page aligned extents, so the mapping is over-allocated by one huge page
+    // and trimmed to an aligned start, with its length rounded up to whole huge pages
+    const auto alignment = (pages == Pages::Huge) ? huge_page_size() : std::size_t{1};
+    if (size > std::numeric_limits<std::size_t>::max() - 2 * alignment) {
+        throw std::length_error("local buffer is too large");
+    }
+
+    const auto length    = (size + alignment - 1) / alignment * alignment;
+    const auto reserved  = length + (alignment > 1 ? alignment : 0);
+
+    auto* mapping = ::mmap(nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) {
+        throw std::system_error(errno, std::generic_category(), "failed to map anonymous memory");
+    }
+
+    const auto address = reinterpret_cast<std::uintptr_t>(mapping);
+    const auto aligned = (address + alignment - 1) / alignment * alignment;
+
+    const auto head = aligned - address;
+    const auto tail = reserved - head - length;
+    if (head > 0) ::munmap(mapping, head);
+    if (tail > 0) ::munmap(reinterpret_cast<void*>(aligned + length), tail);
+
+    m_data   = reinterpret_cast<void*>(aligned);
+    m_mapped = length;
+
+#if defined(MADV_HUGEPAGE)
+    // Huge pages are only a hint: if they aren't available the mapping silently keeps normal pages
+    if (pages == Pages::Huge) ::madvise(m_data, m_mapped, MADV_HUGEPAGE);
+#endif
+}
+
+LocalBuffer::~LocalBuffer() {
+    release();
+}
+
+LocalBuffer::LocalBuffer(LocalBuffer&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)),
+          m_size(std::exchange(other.m_size, 0)),
+          m_mapped(std::exchange(other.m_mapped, 0)) {}
+
+LocalBuffer& LocalBuffer::operator=(LocalBuffer&& other) noexcept {
+    if (this != &other) {
+        release();
+        m_data   = std::exchange(other.m_data, nullptr);
+        m_size   = std::exchange(other.m_size, 0);
+        m_mapped = std::exchange(other.m_mapped, 0);
+    }
+    return *this;
+}
+
+void LocalBuffer::release() noexcept {
+    if (m_data != nullptr) ::munmap(m_data, m_mapped);
+    m_data   = nullptr;
+    m_size   = 0;
+    m_mapped = 0;
+}
+
+} // namespace moxie::Util
@@ -0,0 +1,109 @@
+#include "Util/MappedFile.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+
+namespace moxie::Util {
+
+namespace {
+
+[[noreturn]] void throw_error(int error, const char* what) {
+    throw std::system_error(error, std::generic_category(), what);
+}
+
+[[noreturn]] void throw_errno(const char* what) {
+    throw_error(errno, what);
+}
+
+int to_native(MappedFile::Advice advice) {
+    switch (advice) {
+        case MappedFile::Advice::Sequential: return MADV_SEQUENTIAL;
+        case MappedFile::Advice::Random:     return MADV_RANDOM;
+        case MappedFile::Advice::WillNeed:   return MADV_WILLNEED;
+        case MappedFile::Advice::DontNeed:   return MADV_DONTNEED;
+        case MappedFile::Advice::Normal:
+        default:                             return MADV_NORMAL;
+    }
+}
+
+}
+
+MappedFile::MappedFile(const std::string& path, std::size_t size) : m_size(size) {
+    m_fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (m_fd < 0) {
+        throw_errno("failed to open mapped file");
+    }
+
+    if (::ftruncate(m_fd, static_cast<off_t>(size)) != 0) {
+        // release() closes the file, which may overwrite errno
+        const int error = errno;
+        release();
+        throw_error(error, "failed to resize mapped file");
+    }
+
+    // An empty mapping is valid, but mmap rejects zero-length requests
+    if (size == 0) return;
+
+    m_data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (m_data == MAP_FAILED) {
+        m_data = nullptr;
+        const int error = errno;
+        release();
+        throw_error(error, "failed to map file");
+    }
+}
+
+MappedFile::~MappedFile() {
+    release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+        : m_fd(std::exchange(other.m_fd, -1)),
+          m_data(std::exchange(other.m_data, nullptr)),
+          m_size(std::exchange(other.m_size, 0)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        m_fd   = std::exchange(other.m_fd, -1);
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+}
+
+void MappedFile::advise(Advice advice, std::size_t offset, std::size_t length) const {
+    if (m_data == nullptr || length == 0 || offset >= m_size) return;
+
+    // madvise requires a page-aligned address, so round the range out to whole pages
+    static const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+
+    const auto first = offset - offset % page_size;
+    const auto last  = std::min(offset + length, m_size);
+
+    // Advice is only a hint, so failures are deliberately ignored
+    ::madvise(static_cast<char*>(m_data) + first, last - first, to_native(advice));
+}
+
+void MappedFile::sync() const {
+    if (m_data != nullptr && ::msync(m_data, m_size, MS_SYNC) != 0) {
+        throw_errno("failed to sync mapped file");
+    }
+}
+
+void MappedFile::release() noexcept {
+    if (m_data != nullptr) ::munmap(m_data, m_size);
+    if (m_fd >= 0)         ::close(m_fd);
+
+    m_data = nullptr;
+    m_fd   = -1;
+}
+
+} // namespace moxie::Util
@@ -0,0 +1,102 @@
+#include "Util/Parallel.hpp"
+
+#include "Util/Topology.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+namespace moxie::Util {
+
+std::size_t thread_count(std::size_t n, std::size_t threshold) {
+    if (n < threshold) return 1;
+
+    const auto hardware = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    return std::clamp<std::size_t>(hardware, 1, std::max<std::size_t>(n, 1));
+}
+
+namespace {
+
+//! @short  Restores the calling thread's CPU affinity when it goes out of scope.
+class AffinityGuard {
+public:
+#if defined(__linux__)
+    AffinityGuard() { m_saved = ::pthread_getaffinity_np(::pthread_self(), sizeof(m_set), &m_set) == 0; }
+    ~AffinityGuard() { if (m_saved) ::pthread_setaffinity_np(::pthread_self(), sizeof(m_set), &m_set); }
+
+private:
+    cpu_set_t m_set{};
+    bool      m_saved = false;
+#endif
+};
+
+}
+
+void parallel_for(std::size_t n,
+                  std::size_t threads,
+                  const std::function<void(std::size_t thread, std::size_t begin, std::size_t end)>& fn) {
+    parallel_for(n, threads, {}, fn);
+}
+
+void parallel_for(std::size_t n,
+                  std::size_t threads,
+                  const std::vector<std::size_t>& cpus,
+                  const std::function<void(std::size_t thread, std::size_t begin, std::size_t end)>& fn) {
+    threads = std::clamp<std::size_t>(threads, 1, std::max<std::size_t>(n, 1));
+
+    // Spread the remainder over the first ranges, so range sizes differ by at most 1
+    const auto range = [&](std::size_t t) {
+        const auto base = n / threads, extra = n % threads;
+        const auto begin = t * base + std::min(t, extra);
+        return std::make_pair(begin, begin + base + (t < extra ? 1 : 0));
+    };
+
+    if (threads == 1 && cpus.empty()) {
+        fn(0, 0, n);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(threads);
+    auto run = [&](std::size_t t) {
+        try {
+#if defined(__linux__)
+            // A range that can't be pinned would silently first-touch its memory on the wrong node
+            if (!cpus.empty() && !pin_this_thread(cpus[t % cpus.size()])) {
+                throw std::invalid_argument("failed to pin a thread to cpu " + std::to_string(cpus[t % cpus.size()]));
+            }
+#endif
+
+            const auto [begin, end] = range(t);
+            fn(t, begin, end);
+        } catch (...) {
+            errors[t] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers{}; workers.reserve(threads - 1);
+    for (std::size_t t = 1; t < threads; ++t) workers.emplace_back(run, t);
+
+    if (cpus.empty()) {
+        run(0);
+    } else {
+        // The calling thread only borrows its pinning for the duration of its range
+        AffinityGuard guard;
+        run(0);
+    }
+    for (auto& worker : workers) worker.join();
+
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+}
+
+} // namespace moxie::Util
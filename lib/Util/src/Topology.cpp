@@ -0,0 +1,192 @@
+#include "Util/Topology.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+namespace moxie::Util {
+
+namespace {
+
+bool read_line(const std::string& path, std::string& line) {
+    std::ifstream file{path};
+    return static_cast<bool>(std::getline(file, line));
+}
+
+bool read_number(const std::string& path, std::size_t& value) {
+    std::string line;
+    if (!read_line(path, line)) return false;
+
+    try {
+        value = std::stoul(line);
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+}
+
+std::vector<std::size_t> parse_cpu_list(const std::string& list) {
+    std::vector<std::size_t> cpus;
+
+    std::size_t pos = 0;
+    while (pos < list.size()) {
+        auto end = list.find(',', pos);
+        if (end == std::string::npos) end = list.size();
+
+        const auto item = list.substr(pos, end - pos);
+        pos = end + 1;
+
+        // Tolerate the trailing newline sysfs files end with
+        if (item.find_first_not_of(" \n") == std::string::npos) continue;
+
+        try {
+            const auto dash = item.find('-');
+            const auto first = std::stoul(item.substr(0, dash));
+            const auto last  = (dash == std::string::npos) ? first : std::stoul(item.substr(dash + 1));
+            if (last < first) { throw std::invalid_argument("range is reversed"); }
+
+            for (auto cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+        } catch (const std::exception&) {
+            throw std::invalid_argument("malformed cpu list: " + list);
+        }
+    }
+
+    return cpus;
+}
+
+std::vector<std::size_t> allowed_cpus() {
+    std::vector<std::size_t> out;
+
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (::sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (std::size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) out.push_back(cpu);
+        }
+    }
+#endif
+
+    return out;
+}
+
+Topology Topology::detect(const std::string& root) {
+    return detect(root, allowed_cpus());
+}
+
+Topology Topology::detect(const std::string& root, const std::vector<std::size_t>& allowed) {
+    Topology topology;
+
+    const auto is_allowed = [&](std::size_t id) {
+        return allowed.empty() || std::find(allowed.begin(), allowed.end(), id) != allowed.end();
+    };
+
+    std::string online;
+    if (read_line(root + "/cpu/online", online)) {
+        for (const auto id : parse_cpu_list(online)) {
+            if (!is_allowed(id)) continue;
+
+            const auto base = root + "/cpu/cpu" + std::to_string(id) + "/topology/";
+
+            auto cpu = Cpu{id, id, 0, 0};
+            read_number(base + "core_id", cpu.core);
+            read_number(base + "physical_package_id", cpu.socket);
+            topology.m_cpus.push_back(cpu);
+        }
+
+        // Each node lists its CPUs, so nodes that have none (e.g. memory-only nodes) are simply never seen
+        std::string nodes;
+        if (read_line(root + "/node/online", nodes)) {
+            for (const auto node : parse_cpu_list(nodes)) {
+                std::string list;
+                if (!read_line(root + "/node/node" + std::to_string(node) + "/cpulist", list)) continue;
+
+                for (const auto id : parse_cpu_list(list)) {
+                    for (auto& cpu : topology.m_cpus) {
+                        if (cpu.id == id) cpu.node = node;
+                    }
+                }
+            }
+        }
+    }
+
+    // Without sysfs, fall back to a single node of the CPUs we may run on (or just count them)
+    if (topology.m_cpus.empty() && !allowed.empty()) {
+        for (const auto id : allowed) topology.m_cpus.push_back(Cpu{id, id, 0, 0});
+    } else if (topology.m_cpus.empty()) {
+        const auto hardware = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        for (std::size_t id = 0; id < hardware; ++id) topology.m_cpus.push_back(Cpu{id, id, 0, 0});
+    }
+
+    return topology;
+}
+
+std::size_t Topology::nodes() const {
+    std::vector<std::size_t> nodes;
+    for (const auto& cpu : m_cpus) nodes.push_back(cpu.node);
+
+    std::sort(nodes.begin(), nodes.end());
+    return static_cast<std::size_t>(std::unique(nodes.begin(), nodes.end()) - nodes.begin());
+}
+
+std::vector<std::size_t> Topology::schedule(std::size_t threads) const {
+    // Without any known CPUs there is nothing to pin to, and parallel_for treats an empty list as unpinned
+    if (m_cpus.empty()) return {};
+
+    // Group the CPUs of each node into "rounds": round 0 holds the first hardware thread of every physical core,
+    // round 1 the second (the hyper-threaded siblings), and so on
+    std::map<std::size_t, std::vector<std::vector<std::size_t>>> rounds;
+    std::map<std::pair<std::size_t, std::size_t>, std::size_t> seen;
+
+    for (const auto& cpu : m_cpus) {
+        const auto round = seen[{cpu.socket, cpu.core}]++;
+
+        auto& node = rounds[cpu.node];
+        if (node.size() <= round) node.resize(round + 1);
+        node[round].push_back(cpu.id);
+    }
+
+    // Flatten each node round by round, then deal the nodes out in turn
+    std::vector<std::vector<std::size_t>> per_node;
+    for (const auto& [node, node_rounds] : rounds) {
+        auto& order = per_node.emplace_back();
+        for (const auto& round : node_rounds) order.insert(order.end(), round.begin(), round.end());
+    }
+
+    std::vector<std::size_t> order;
+    for (std::size_t i = 0; order.size() < m_cpus.size(); ++i) {
+        for (const auto& node : per_node) {
+            if (i < node.size()) order.push_back(node[i]);
+        }
+    }
+
+    std::vector<std::size_t> cpus(threads);
+    for (std::size_t t = 0; t < threads; ++t) cpus[t] = order[t % order.size()];
+    return cpus;
+}
+
+bool pin_this_thread(std::size_t cpu) {
+#if defined(__linux__)
+    if (cpu >= CPU_SETSIZE) return false;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+} // namespace moxie::Util
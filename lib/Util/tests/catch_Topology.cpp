@@ -0,0 +1,168 @@
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "Util/LocalArray.hpp"
+#include "Util/Parallel.hpp"
+#include "Util/Topology.hpp"
+
+using namespace moxie::Util;
+
+
+namespace {
+
+void write_file(const std::filesystem::path& path, const std::string& contents) {
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream{path} << contents << "\n";
+}
+
+void write_cpu(const std::filesystem::path& root, std::size_t id, std::size_t core, std::size_t socket) {
+    const auto base = root / "cpu" / ("cpu" + std::to_string(id)) / "topology";
+    write_file(base / "core_id", std::to_string(core));
+    write_file(base / "physical_package_id", std::to_string(socket));
+}
+
+/**
+ *  A fake sysfs tree of two sockets (one node each) with uneven CPU lists:
+ *      node 0: cpus 0, 1, 4 where cpu 1 is the hyper-threaded sibling of cpu 0
+ *      node 1: cpus 2, 3, 5, 6 each on their own core
+ */
+std::filesystem::path make_fake_sysfs() {
+    const auto root = std::filesystem::temp_directory_path() / "moxie_catch_Topology";
+    std::filesystem::remove_all(root);
+
+    write_file(root / "cpu" / "online", "0-6");
+    write_file(root / "node" / "online", "0-1");
+    write_file(root / "node" / "node0" / "cpulist", "0-1,4");
+    write_file(root / "node" / "node1" / "cpulist", "2-3,5-6");
+
+    write_cpu(root, 0, 0, 0);
+    write_cpu(root, 1, 0, 0);
+    write_cpu(root, 4, 1, 0);
+    write_cpu(root, 2, 0, 1);
+    write_cpu(root, 3, 1, 1);
+    write_cpu(root, 5, 2, 1);
+    write_cpu(root, 6, 3, 1);
+
+    return root;
+}
+
+} // namespace
+
+
+TEST_CASE("parse_cpu_list: parses sysfs cpu lists") {
+    REQUIRE(parse_cpu_list("0-3") == std::vector<std::size_t>{0, 1, 2, 3});
+    REQUIRE(parse_cpu_list("5") == std::vector<std::size_t>{5});
+    REQUIRE(parse_cpu_list("0-1,4,8-9") == std::vector<std::size_t>{0, 1, 4, 8, 9});
+    REQUIRE(parse_cpu_list("2,3\n") == std::vector<std::size_t>{2, 3});
+    REQUIRE(parse_cpu_list("").empty());
+
+    SECTION("should raise an error for malformed lists") {
+        REQUIRE_THROWS_AS(parse_cpu_list("a-b"), std::invalid_argument);
+        REQUIRE_THROWS_AS(parse_cpu_list("3-1"), std::invalid_argument);
+        REQUIRE_THROWS_AS(parse_cpu_list("0-"), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Topology: detects cpus, cores and nodes from sysfs") {
+    const auto root = make_fake_sysfs();
+    const auto topology = Topology::detect(root.string(), {});
+
+    REQUIRE(topology.cpus().size() == 7);
+    REQUIRE(topology.nodes() == 2);
+
+    for (const auto& cpu : topology.cpus()) {
+        const auto on_node_0 = cpu.id == 0 || cpu.id == 1 || cpu.id == 4;
+        REQUIRE(cpu.node == (on_node_0 ? 0 : 1));
+        REQUIRE(cpu.socket == cpu.node);
+    }
+
+    SECTION("schedule interleaves the nodes, and cores before their siblings") {
+        REQUIRE(topology.schedule(7) == std::vector<std::size_t>{0, 2, 4, 3, 1, 5, 6});
+    }
+
+    SECTION("schedule wraps around when there are more threads than cpus") {
+        REQUIRE(topology.schedule(9) == std::vector<std::size_t>{0, 2, 4, 3, 1, 5, 6, 0, 2});
+        REQUIRE(topology.schedule(2) == std::vector<std::size_t>{0, 2});
+    }
+
+    SECTION("only cpus in the affinity mask are kept") {
+        const auto restricted = Topology::detect(root.string(), {0, 2, 5, 9});
+
+        REQUIRE(restricted.cpus().size() == 3);
+        REQUIRE(restricted.nodes() == 2);
+        REQUIRE(restricted.schedule(4) == std::vector<std::size_t>{0, 2, 5, 0});
+    }
+
+    std::filesystem::remove_all(root);
+}
+
+TEST_CASE("Topology: only hands out cpus the process may run on") {
+    const auto allowed = allowed_cpus();
+    const auto topology = Topology::detect();
+
+    for (const auto& cpu : topology.cpus()) {
+        REQUIRE((allowed.empty() || std::find(allowed.begin(), allowed.end(), cpu.id) != allowed.end()));
+    }
+}
+
+TEST_CASE("Topology: falls back to a single node without sysfs") {
+    const auto topology = Topology::detect("/nonexistent/moxie/sysfs");
+
+    REQUIRE_FALSE(topology.cpus().empty());
+    REQUIRE(topology.nodes() == 1);
+    REQUIRE(topology.schedule(3).size() == 3);
+
+    REQUIRE(Topology{}.schedule(4).empty());
+}
+
+TEST_CASE("parallel_for: pinned ranges cover every index exactly once") {
+    const auto cpus = Topology::detect().schedule(4);
+
+    std::vector<int> visits(1001, 0);
+    parallel_for(visits.size(), 4, cpus, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) ++visits[i];
+    });
+
+    REQUIRE(std::all_of(visits.begin(), visits.end(), [](int count) { return count == 1; }));
+
+#if defined(__linux__)
+    SECTION("should raise an error when a range can't be pinned") {
+        const auto invalid = std::vector<std::size_t>{std::size_t{1} << 20};
+        REQUIRE_THROWS_AS(parallel_for(10, 2, invalid, [](std::size_t, std::size_t, std::size_t) {}),
+                          std::invalid_argument);
+    }
+#endif
+}
+
+TEST_CASE("LocalArray: is zero-filled and reports its shape") {
+    const auto cpus = Topology::detect().schedule(3);
+
+    for (const auto pages : {Pages::Normal, Pages::Huge}) {
+        LocalArray<double> array{100, 7, 3, cpus, pages};
+
+        REQUIRE(array.size() == 700);
+        REQUIRE(array.rows() == 100);
+        REQUIRE(array.row_size() == 7);
+        REQUIRE(array.row(2) == array.data() + 14);
+        REQUIRE(std::all_of(array.begin(), array.end(), [](double value) { return value == 0.0; }));
+    }
+
+    REQUIRE(LocalArray<int>{0, 4, 2}.size() == 0);
+
+    SECTION("huge page arrays are aligned to the huge page size") {
+        LocalArray<double> array{1000, 3, 2, cpus, Pages::Huge};
+        REQUIRE(reinterpret_cast<std::uintptr_t>(array.data()) % (std::size_t{2} << 20) == 0);
+    }
+
+    SECTION("should raise an error when the size overflows") {
+        const auto rows = std::numeric_limits<std::size_t>::max() / 4;
+        REQUIRE_THROWS_AS(LocalArray<double>(rows, 4, 1), std::length_error);
+    }
+}